@@ -0,0 +1,73 @@
+//
+// Copyright (c) 2012 Janick Bergeron
+// All Rights Reserved
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//
+
+
+#ifndef __BONELIB_BOARD__
+#define __BONELIB_BOARD__
+
+#include <stdio.h>
+
+#include "pinmux.hpp"
+
+namespace BeagleBone {
+
+/** Requested muxing of one pin in a board description */
+struct pin_config
+{
+  pin*             p;
+  pin_fct*         fct;
+  pin::direction_t dir;
+  pin::pull_t      pulls;
+};
+
+/** What board::configure() did with one pin of the description */
+struct pin_change
+{
+  typedef enum {UNCHANGED, CHANGED, FAILED} status_t;
+
+  pin*     p;
+  pin_fct* from;
+  pin_fct* to;
+  int      old_code;    // -1 if it could not be read back
+  int      new_code;
+  status_t status;
+};
+
+/** Class muxing all the pins of a board at once */
+class board
+{
+public:
+  /** Mux every pin of a board description.
+   *  The whole description is checked first (pins able to carry the function,
+   *  locks, functions claimed twice or carried by another pin) and the mux
+   *  files of the pins to change are all opened before any is written, so a
+   *  bad description leaves every pin as it was. Pins already in the
+   *  requested mode are not written.
+   *  If report is not NULL, it receives one entry per line of cfg.
+   *  Returns TRUE if every pin is now in its requested mode.
+   */
+  static int configure(const pin_config* cfg, int n, pin_change* report = NULL);
+
+  /** Print a report filled by configure(), one line per pin */
+  static void print_report(FILE* fp, const pin_change* report, int n);
+};
+
+}
+
+#endif
@@ -0,0 +1,193 @@
+/*
+BSD License
+Copyright © 2013, Bence Magyar
+All rights reserved.
+Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+Neither the name of the owner nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#ifndef __COMMANDQUEUE_H_
+#define __COMMANDQUEUE_H_
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+/** A setpoint for one output channel, stamped with CLOCK_MONOTONIC ns when posted. */
+struct Command
+{
+    int channel;
+    int value;
+    uint64_t timestamp;
+};
+
+/**
+ * \brief Bounded single-producer/single-consumer ring. Both sides are wait-free.
+ *
+ * push() never allocates or blocks: when the ring is full the element is
+ * dropped and counted. N must be a power of two.
+ **/
+template <typename T, size_t N>
+class SpscQueue
+{
+    static_assert(N && (N & (N - 1)) == 0, "SpscQueue size must be a power of two");
+
+public:
+    SpscQueue()
+        : _head(0), _tail(0), _drops(0)
+    {
+    }
+
+    /** Producer side. Returns false (and counts a drop) if the ring is full. */
+    bool push(const T& value)
+    {
+        const size_t tail = _tail.load(std::memory_order_relaxed);
+        if(tail - _head.load(std::memory_order_acquire) == N)
+        {
+            _drops.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        _buffer[tail & (N - 1)] = value;
+        _tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** Consumer side. Returns false if the ring is empty. */
+    bool pop(T& value)
+    {
+        const size_t head = _head.load(std::memory_order_relaxed);
+        if(head == _tail.load(std::memory_order_acquire))
+            return false;
+        value = _buffer[head & (N - 1)];
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    size_t depth() const
+    {
+        return _tail.load(std::memory_order_acquire) - _head.load(std::memory_order_acquire);
+    }
+
+    unsigned long drops() const
+    {
+        return _drops.load(std::memory_order_relaxed);
+    }
+
+    static size_t capacity()
+    {
+        return N;
+    }
+
+private:
+    SpscQueue(const SpscQueue&);
+    SpscQueue& operator=(const SpscQueue&);
+
+    // producer and consumer indices on their own cache lines
+    alignas(64) std::atomic<size_t> _head;
+    alignas(64) std::atomic<size_t> _tail;
+    std::atomic<unsigned long> _drops;
+    alignas(64) T _buffer[N];
+};
+
+/**
+ * \brief Bounded multi-producer/single-consumer ring.
+ *
+ * Producers claim a slot with one compare-and-swap on the tail and publish it
+ * through a per-slot sequence number, so push() never allocates or takes a
+ * lock; pop() is wait-free. When the ring is full the element is dropped and
+ * counted. N must be a power of two.
+ **/
+template <typename T, size_t N>
+class MpscQueue
+{
+    static_assert(N && (N & (N - 1)) == 0, "MpscQueue size must be a power of two");
+
+public:
+    MpscQueue()
+        : _head(0), _tail(0), _drops(0)
+    {
+        for(size_t i = 0; i < N; ++i)
+            _cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    /** Any thread. Returns false (and counts a drop) if the ring is full. */
+    bool push(const T& value)
+    {
+        size_t pos = _tail.load(std::memory_order_relaxed);
+        Cell* cell;
+        for(;;)
+        {
+            cell = &_cells[pos & (N - 1)];
+            const size_t seq = cell->sequence.load(std::memory_order_acquire);
+            const long diff = (long)seq - (long)pos;
+            if(diff == 0)
+            {
+                if(_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if(diff < 0)
+            {
+                _drops.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            else
+            {
+                pos = _tail.load(std::memory_order_relaxed);
+            }
+        }
+        cell->value = value;
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** Consumer thread only. Returns false if the ring is empty. */
+    bool pop(T& value)
+    {
+        const size_t pos = _head.load(std::memory_order_relaxed);
+        Cell* cell = &_cells[pos & (N - 1)];
+        if(cell->sequence.load(std::memory_order_acquire) != pos + 1)
+            return false;
+        value = cell->value;
+        cell->sequence.store(pos + N, std::memory_order_release);
+        _head.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    size_t depth() const
+    {
+        const size_t tail = _tail.load(std::memory_order_acquire);
+        const size_t head = _head.load(std::memory_order_acquire);
+        return tail > head ? tail - head : 0;
+    }
+
+    unsigned long drops() const
+    {
+        return _drops.load(std::memory_order_relaxed);
+    }
+
+    static size_t capacity()
+    {
+        return N;
+    }
+
+private:
+    MpscQueue(const MpscQueue&);
+    MpscQueue& operator=(const MpscQueue&);
+
+    struct Cell
+    {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    alignas(64) std::atomic<size_t> _head;
+    alignas(64) std::atomic<size_t> _tail;
+    std::atomic<unsigned long> _drops;
+    alignas(64) Cell _cells[N];
+};
+
+#endif
@@ -0,0 +1,97 @@
+/*
+BSD License
+Copyright © 2013, Bence Magyar
+All rights reserved.
+Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+Neither the name of the owner nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#ifndef __CONTROLLOOP_H_
+#define __CONTROLLOOP_H_
+
+#include <atomic>
+#include <pthread.h>
+#include <stdint.h>
+#include <vector>
+
+/**
+ * \brief Runs callbacks at a fixed rate on a dedicated, optionally real-time, thread.
+ *
+ * Cycles are scheduled on absolute CLOCK_MONOTONIC deadlines with
+ * clock_nanosleep(TIMER_ABSTIME), so the period does not drift with the time
+ * the callbacks take. A cycle that ends after the next deadline is an overrun;
+ * the missed deadlines are skipped rather than run back to back. Wake-up jitter
+ * is the delay between a deadline and the thread actually running.
+ **/
+class ControlLoop
+{
+public:
+    typedef void (*callback_t)(void* arg);
+
+    struct Stats
+    {
+        unsigned long cycles;
+        unsigned long overruns;
+        int64_t maxJitterNs;
+        int64_t meanJitterNs;
+        int64_t maxCycleNs;  // time spent in the callbacks
+    };
+
+    explicit ControlLoop(int64_t periodNs);
+    ~ControlLoop();
+
+    /** Register a callback, called every period in registration order. Before start() only. */
+    bool add(callback_t callback, void* arg);
+
+    /** Run with SCHED_FIFO at this priority (1..99), 0 for the normal scheduler. */
+    void setPriority(int priority);
+    /** Pin the loop thread to one CPU, -1 for any. */
+    void setCpu(int cpu);
+    /** mlockall() the process on start so page faults cannot stall a cycle. */
+    void setLockMemory(bool lock);
+
+    bool start();
+    void stop();
+    bool running() const;
+
+    int64_t periodNs() const;
+    Stats stats() const;
+    /** Can be called from any thread, the loop thread applies it on its next cycle. */
+    void resetStats();
+
+private:
+    ControlLoop(const ControlLoop&);
+    ControlLoop& operator=(const ControlLoop&);
+
+    struct Callback
+    {
+        callback_t callback;
+        void* arg;
+    };
+
+    static void* run(void* self);
+    void loop();
+    void clearStats();
+
+    std::vector<Callback> _callbacks;
+    const int64_t _periodNs;     // nanoseconds are int64_t, long wraps at 2.1 s on 32-bit ARM
+    int _priority;
+    int _cpu;
+    bool _lockMemory;
+
+    pthread_t _thread;
+    std::atomic<bool> _running;
+
+    std::atomic<unsigned long> _cycles;
+    std::atomic<unsigned long> _overruns;
+    std::atomic<int64_t> _maxJitterNs;
+    std::atomic<int64_t> _sumJitterNs;
+    std::atomic<int64_t> _maxCycleNs;
+    std::atomic<bool> _resetPending;
+};
+
+#endif
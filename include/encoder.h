@@ -0,0 +1,81 @@
+/*
+BSD License
+Copyright © 2013, Bence Magyar
+All rights reserved.
+Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+Neither the name of the owner nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#ifndef __ENCODER_H_
+#define __ENCODER_H_
+
+#include <stdint.h>
+
+#include "memmap.h"
+#include "sysfsattr.h"
+
+/**
+ * \brief Quadrature encoder on eQEP2 (A/B on P8_12/P8_11 or P8_41/P8_42).
+ *
+ * Position is the eQEP counter, 4 counts per encoder line. With the register
+ * backend velocity is estimated by the eQEP itself every unit period: from
+ * the counts latched at the unit timeouts when the encoder turns fast, and
+ * from the capture timer (time taken by the last 4 counts) when it turns
+ * slowly, where counting over a unit period would be too coarse. The sysfs
+ * eqep driver only gives the position, velocity is then its difference over
+ * the unit period. MemMap::setDevice() and SysfsAttr::setRoot() point both at
+ * fake files.
+ **/
+class Encoder
+{
+public:
+    typedef enum {SYSFS, MMAP} backend_t;
+
+    Encoder();
+    ~Encoder();
+
+    /** Mux the A/B inputs and start counting from 0, estimating velocity every
+     *  unitPeriodNs. MMAP falls back to SYSFS when the registers cannot be mapped.
+     */
+    bool open(backend_t backend = MMAP, long unitPeriodNs = 10000000);
+    void close();
+    bool isOpen() const;
+
+    /** Backend actually in use after open(). */
+    backend_t backend() const;
+
+    /** Current position in counts. */
+    int32_t position();
+    /** Make the current position read as pos. */
+    void setPosition(int32_t pos);
+
+    /** Velocity in counts per second, as of the last unit period. */
+    double velocity();
+
+private:
+    Encoder(const Encoder&);
+    Encoder& operator=(const Encoder&);
+
+    bool mux();
+    bool openRegisters();
+    bool openSysfs();
+
+    backend_t _backend;
+    bool _open;
+    long _unitPeriodNs;
+    double _velocity;
+
+    MemMap _regs;
+    uint32_t _latched;       // QPOSLAT at the last unit timeout read
+    uint64_t _latchedNs;     // when it was latched
+
+    SysfsAttr _position;
+    uint64_t _sampleNs;      // time of the last sysfs velocity sample
+    int32_t _sample;
+};
+
+#endif
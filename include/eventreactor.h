@@ -0,0 +1,91 @@
+/*
+BSD License
+Copyright © 2013, Bence Magyar
+All rights reserved.
+Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+Neither the name of the owner nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#ifndef __EVENTREACTOR_H_
+#define __EVENTREACTOR_H_
+
+#include <atomic>
+#include <pthread.h>
+#include <stdint.h>
+#include <vector>
+
+#include "gpio.hpp"
+
+/**
+ * \brief Waits on GPIO edges and timers with one epoll set and dispatches callbacks.
+ *
+ * Each GPIO pin is watched through its sysfs value file (POLLPRI), each timer
+ * is a timerfd, so limit switches, bumpers and timed actions share a single
+ * thread instead of one polling thread per sensor. sysfs carries no event
+ * time, so callbacks get the CLOCK_MONOTONIC time the reactor woke up at;
+ * events delivered by the same wake-up share it.
+ **/
+class EventReactor
+{
+public:
+    /** value is the pin level read right after the edge. */
+    typedef void (*edge_callback_t)(BeagleBone::gpio* pin, unsigned char value, uint64_t timestampNs, void* arg);
+    /** expirations is how many times the timer fired since the last call. */
+    typedef void (*timer_callback_t)(uint64_t expirations, uint64_t timestampNs, void* arg);
+
+    EventReactor();
+    ~EventReactor();
+
+    /** Configure the edges of an exported input pin and call back on them. Before start() only. */
+    bool addEdge(BeagleBone::gpio* pin, BeagleBone::gpio::edge_t edge, edge_callback_t callback, void* arg);
+
+    /** Register a timer, disarmed. Returns its id for armTimer(), -1 on error. Before start() only. */
+    int addTimer(timer_callback_t callback, void* arg);
+
+    /** Fire timer id after delayNs, then every periodNs (0 for once). A delay of 0 disarms it.
+     *  Can be called from any thread, also while running. */
+    bool armTimer(int id, int64_t delayNs, int64_t periodNs = 0);
+
+    /** Wait up to timeoutMs (-1 forever) and dispatch, on the calling thread.
+     *  Returns the number of events dispatched, -1 on error. */
+    int poll(int timeoutMs);
+
+    /** Run poll() on a dedicated thread until stop(). */
+    bool start();
+    void stop();
+    bool running() const;
+
+    unsigned long events() const;
+
+private:
+    EventReactor(const EventReactor&);
+    EventReactor& operator=(const EventReactor&);
+
+    enum { MAX_EVENTS = 16 };
+
+    struct Source
+    {
+        int fd;
+        BeagleBone::gpio* pin;       // NULL for timers
+        edge_callback_t onEdge;
+        timer_callback_t onTimer;
+        void* arg;
+    };
+
+    bool watch(int fd, uint32_t events, uint32_t index);
+    static void* run(void* self);
+
+    std::vector<Source> _sources;
+    int _epoll;
+    int _wake;                       // eventfd that interrupts the wait on stop()
+
+    pthread_t _thread;
+    std::atomic<bool> _running;
+    std::atomic<unsigned long> _events;
+};
+
+#endif
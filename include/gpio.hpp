@@ -21,28 +21,49 @@
 #define __BONELIB_GPIO__
 
 #include "pinmux.hpp"
+#include "latencyhistogram.h"
+#include "tracering.h"
 
 namespace BeagleBone {
 
+class gpio_port;
+
 /** Class representing a GPIO pin */
 class gpio: public pin
 {
   friend class pin;
+  friend struct pin_table;
+  friend class gpio_port;
 
 public:
+  /** How set() and get() reach the pin: through its sysfs value file
+   *  or directly through the registers of its GPIO bank (see gpio_port).
+   */
+  typedef enum {SYSFS, MMAP} backend_t;
+
+  /** Signal edges that make the value file ready for poll()/epoll (POLLPRI) */
+  typedef enum {NO_EDGE, RISING, FALLING, BOTH} edge_t;
+
   /** Get the GPIO pin corresponding to a connector pin.
    *  Returns NULL if it does not support GPIO or it cannot be muxed to its GPIO function.
+   *  MMAP falls back to SYSFS when the bank registers cannot be mapped.
    */
-  static gpio* P8(unsigned char n);
-  static gpio* P9(unsigned char n);
+  static gpio* P8(unsigned char n, backend_t backend = SYSFS);
+  static gpio* P9(unsigned char n, backend_t backend = SYSFS);
 
-  /** Configure the direction (and pull resistors) of the GPIO pin */
+  /** Configure the direction (and pull resistors) of the GPIO pin.
+   *  Nothing is written if the pin is already configured that way.
+   */
   int configure(pin::direction_t dir, pin::pull_t pulls = pin::NONE);
 
-  /** Get the current direction of the GPIO pin */
+  /** Get the current direction of the GPIO pin.
+   *  Read from sysfs the first time, then tracked by configure().
+   */
   pin::direction_t get_direction();
 
-  /** Get the pull resistors of the GPIO pin */
+  /** Get the pull resistors of the GPIO pin.
+   *  Read from the pin mux the first time, then tracked by configure().
+   */
   pin::pull_t get_pulls();
 
   /** Set the value of the GPIO pin. Return TRUE if successful. */
@@ -51,29 +72,56 @@ public:
   /** Get the value of the GPIO pin */
   unsigned char get();
 
+  /** Select the edges reported on the value file. Returns TRUE if successful. */
+  int set_edge(edge_t edge);
+
+  /** Descriptor of the open value file, to wait for edges on. -1 on error. */
+  int get_fd();
+
+  /** Time taken by set() and get() on this pin (p50/p99/max).
+   *  Both are also recorded in the TraceRing under the pin name.
+   */
+  LatencyHistogram::Stats get_latency_stats() const;
+
+  /** Clear the set() and get() timings */
+  void reset_latency_stats();
+
 private:
   unsigned char m_number;
   char*         m_dev;
   char*         m_dev_append;
+  int           m_value_fd;
+  gpio_port*    m_port;
+  signed char   m_direction;   // direction_t, -1 until known
+  LatencyHistogram m_latency;
+  uint16_t      m_trace;
 
-  gpio(const char* name,
-       const char* pin_dev,
-       unsigned char  port_no,
-       unsigned char  pin_no,
-       pin_fct* const mode0,
-       pin_fct* const mode1,
-       pin_fct* const mode2,
-       pin_fct* const mode3,
-       pin_fct* const mode4,
-       pin_fct* const mode5,
-       pin_fct* const mode6,
-       pin_fct* const mode7,
-       int            init,
-       direction_t    dir = IN,
-       pull_t         pulls = NONE);
+  constexpr gpio(const char*    name,
+		 const char*    pin_dev,
+		 unsigned char  port_no,
+		 unsigned char  pin_no,
+		 pin_fct* const mode0,
+		 pin_fct* const mode1,
+		 pin_fct* const mode2,
+		 pin_fct* const mode3,
+		 pin_fct* const mode4,
+		 pin_fct* const mode5,
+		 pin_fct* const mode6,
+		 pin_fct* const mode7,
+		 int            init,
+		 direction_t    dir = IN,
+		 pull_t         pulls = NONE)
+    : pin(name, pin_dev, mode0, mode1, mode2, mode3, mode4, mode5, mode6, mode7, init, dir, pulls),
+      m_number(port_no * 32 + pin_no), m_dev(NULL), m_dev_append(NULL),
+      m_value_fd(-1), m_port(NULL), m_direction(-1), m_trace(0)
+  {
+  }
 
   /** Export the GPIO function of the pin. Returns TRUE on success. */
-  int pin_xport();
+  int pin_xport(backend_t backend);
+
+  /** Open the value file once and keep it. Returns TRUE on success. */
+  int open_value(const char* what);
 };
 
 }
@@ -0,0 +1,116 @@
+//
+// Copyright (c) 2012 Janick Bergeron
+// All Rights Reserved
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//
+
+
+#ifndef __BONELIB_GPIO_PORT__
+#define __BONELIB_GPIO_PORT__
+
+#include <stdint.h>
+
+#include "memmap.h"
+#include "tracering.h"
+
+namespace BeagleBone {
+
+class gpio;
+
+/** Direct register access to one of the four AM335x GPIO banks.
+ *
+ *  Pins are selected by a mask of their bit in the bank (see mask()).
+ *  set() and clear() are a single store to SETDATAOUT/CLEARDATAOUT,
+ *  so they are atomic with respect to any other user of the bank.
+ *  The pins must already be exported and configured (gpio::configure()):
+ *  exporting is what turns on the bank clock.
+ *  Every write is recorded in the TraceRing under the bank ("gpio1").
+ */
+class gpio_port
+{
+  friend class gpio;
+
+public:
+  /** Get GPIO bank n (0-3), mapping its registers on first use.
+   *  Returns NULL if the registers cannot be mapped. Thread-safe.
+   */
+  static gpio_port* bank(unsigned char n);
+
+  /** Get the bank of a GPIO pin */
+  static gpio_port* of(const gpio* pin);
+
+  /** Bit of a GPIO pin in its bank */
+  static uint32_t mask(const gpio* pin);
+
+  /** Drive the pins in mask high, leave the others alone */
+  void set(uint32_t mask)
+  {
+    *m_set = mask;
+#ifdef WITH_TRACE
+    TraceRing::record(m_trace, TraceRing::GPIO_PORT_SET, mask, LatencyHistogram::now(), 0);
+#endif
+  }
+
+  /** Drive the pins in mask low, leave the others alone */
+  void clear(uint32_t mask)
+  {
+    *m_clear = mask;
+#ifdef WITH_TRACE
+    TraceRing::record(m_trace, TraceRing::GPIO_PORT_CLEAR, mask, LatencyHistogram::now(), 0);
+#endif
+  }
+
+  /** Drive the pins in mask to the matching bits of val, all in the
+   *  same store to DATAOUT. This is a read-modify-write of the bank:
+   *  it races with other writers of pins on the same bank.
+   *  Traced as the pins driven high and low.
+   */
+  void write(uint32_t mask, uint32_t val)
+  {
+    *m_dataout = (*m_dataout & ~mask) | (val & mask);
+#ifdef WITH_TRACE
+    uint64_t now = LatencyHistogram::now();
+    if (val & mask) TraceRing::record(m_trace, TraceRing::GPIO_PORT_SET, val & mask, now, 0);
+    if (~val & mask) TraceRing::record(m_trace, TraceRing::GPIO_PORT_CLEAR, ~val & mask, now, 0);
+#endif
+  }
+
+  /** Sample all the pins of the bank at once */
+  uint32_t get() const
+  {
+    return *m_datain;
+  }
+
+  /** Turn the output drivers of the pins in mask on or off */
+  void set_output(uint32_t mask, int enable);
+
+private:
+  MemMap             m_regs;
+  volatile uint32_t* m_oe;
+  volatile uint32_t* m_datain;
+  volatile uint32_t* m_dataout;
+  volatile uint32_t* m_clear;
+  volatile uint32_t* m_set;
+  uint16_t           m_trace;
+
+  gpio_port();
+
+  int map(unsigned char n);
+};
+
+}
+
+#endif
@@ -0,0 +1,135 @@
+/*
+BSD License
+Copyright © 2013, Bence Magyar
+All rights reserved.
+Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+Neither the name of the owner nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#ifndef __LATENCYHISTOGRAM_H_
+#define __LATENCYHISTOGRAM_H_
+
+#include <atomic>
+#include <stdint.h>
+#include <time.h>
+
+/**
+ * \brief Log-scale histogram of how long hardware writes take.
+ *
+ * Bucket b counts durations in [2^b, 2^(b+1)) ns, so recording is a clock read,
+ * a count-leading-zeros and a relaxed atomic increment, and any thread may
+ * record (a channel is written from its caller's thread and from the
+ * MotionScheduler thread when it ramps or moves). Percentiles are reported as the
+ * upper edge of their bucket, i.e. within a factor of two. Built without
+ * WITH_LATENCY_STATS, record() only measures, for the trace (see TraceRing),
+ * and without WITH_TRACE either now() and record() compile to nothing.
+ **/
+class LatencyHistogram
+{
+public:
+    static const int BUCKETS = 32;
+
+    struct Stats
+    {
+        unsigned long count;
+        uint64_t p50Ns;
+        uint64_t p99Ns;
+        uint64_t maxNs;
+    };
+
+    constexpr LatencyHistogram()
+        : _max(0)
+    {
+    }
+
+    /** Timestamp to pass to record() once the write returned. */
+    static inline uint64_t now()
+    {
+#if defined(WITH_LATENCY_STATS) || defined(WITH_TRACE)
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+#else
+        return 0;
+#endif
+    }
+
+    /** Record the time elapsed since start and return it. */
+    inline uint64_t record(uint64_t start)
+    {
+        const uint64_t ns = now() - start;
+#ifdef WITH_LATENCY_STATS
+        int b = 63 - __builtin_clzll(ns | 1);
+        if(b >= BUCKETS)
+            b = BUCKETS - 1;
+        _buckets[b].n.fetch_add(1, std::memory_order_relaxed);
+        uint64_t max = _max.load(std::memory_order_relaxed);
+        while(ns > max && !_max.compare_exchange_weak(max, ns, std::memory_order_relaxed))
+            ;
+#endif
+        return ns;
+    }
+
+    Stats stats() const
+    {
+        uint32_t counts[BUCKETS];
+        unsigned long total = 0;
+        for(int b = 0; b < BUCKETS; ++b)
+        {
+            counts[b] = _buckets[b].n.load(std::memory_order_relaxed);
+            total += counts[b];
+        }
+
+        Stats s;
+        s.count = total;
+        s.maxNs = _max.load(std::memory_order_relaxed);
+        s.p50Ns = percentile(counts, total, 50);
+        s.p99Ns = percentile(counts, total, 99);
+        if(s.p50Ns > s.maxNs)
+            s.p50Ns = s.maxNs;
+        if(s.p99Ns > s.maxNs)
+            s.p99Ns = s.maxNs;
+        return s;
+    }
+
+    void reset()
+    {
+        for(int b = 0; b < BUCKETS; ++b)
+            _buckets[b].n.store(0, std::memory_order_relaxed);
+        _max.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    static uint64_t percentile(const uint32_t* counts, unsigned long total, int pct)
+    {
+        if(total == 0)
+            return 0;
+
+        // smallest bucket holding at least pct% of the samples at or below it
+        const unsigned long rank = (total * pct + 99) / 100;
+        unsigned long seen = 0;
+        for(int b = 0; b < BUCKETS; ++b)
+        {
+            seen += counts[b];
+            if(seen >= rank)
+                return (2ull << b) - 1;
+        }
+        return 0;
+    }
+
+    // a constexpr constructor per element keeps the histogram constant-initialized
+    struct Counter
+    {
+        constexpr Counter() : n(0) {}
+        std::atomic<uint32_t> n;
+    };
+
+    Counter _buckets[BUCKETS];
+    std::atomic<uint64_t> _max;
+};
+
+#endif
@@ -0,0 +1,62 @@
+/*
+BSD License
+Copyright © 2013, Bence Magyar
+All rights reserved.
+Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+Neither the name of the owner nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#ifndef __MEMMAP_H_
+#define __MEMMAP_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * \brief A mapping of a physical register block through /dev/mem.
+ *
+ * The device can be replaced by a plain file with setDevice(); the file then
+ * stands in for the physical address space, i.e. the register at physical
+ * address A is at file offset A (a sparse file of the right size will do).
+ **/
+class MemMap
+{
+public:
+    MemMap();
+    ~MemMap();
+
+    /** Map len bytes starting at physical address phys. Need not be page aligned. */
+    bool map(uint32_t phys, size_t len);
+    void unmap();
+    bool isMapped() const;
+
+    volatile uint16_t* reg16(size_t offset) const
+    {
+        return (volatile uint16_t*)(_base + offset);
+    }
+
+    volatile uint32_t* reg32(size_t offset) const
+    {
+        return (volatile uint32_t*)(_base + offset);
+    }
+
+    /** File mapped by all MemMap objects, /dev/mem by default. */
+    static void setDevice(const char* path);
+    static const char* device();
+
+private:
+    MemMap(const MemMap&);
+    MemMap& operator=(const MemMap&);
+
+    void* _map;
+    size_t _mapLen;
+    volatile uint8_t* _base;
+
+    static const char* _device;
+};
+
+#endif
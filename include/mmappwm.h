@@ -0,0 +1,59 @@
+/*
+BSD License
+Copyright © 2013, Bence Magyar
+All rights reserved.
+Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+Neither the name of the owner nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#ifndef __MMAPPWM_H_
+#define __MMAPPWM_H_
+
+#include <stdint.h>
+#include <string>
+
+#include "memmap.h"
+#include "pwmbackend.h"
+
+/**
+ * \brief PWM output driven by writing the EHRPWM registers through MemMap.
+ *
+ * A duty update is a single 16-bit store to CMPA/CMPB. The two outputs of a
+ * module share the time base (TBPRD and the prescaler), so both must be run
+ * with the same period. The PWMSS clocks must already be enabled (see
+ * MotorPwm::enablepwm()). Only ehrpwm devices are supported, not ecap.
+ * There is no claim on the registers: set_request(1) sets the output up
+ * stopped, set_request(0) stops it and clears its compare register.
+ **/
+class MmapPwm : public PwmBackend
+{
+public:
+    MmapPwm();
+
+    /** Map the registers of device (e.g. "ehrpwm.1:0"). */
+    bool open(const std::string& device);
+    void close();
+
+    std::string requestStatus() const;
+
+    bool set_request(int val);
+    /** Clamped to 0..period. Fails until set_period() has been called. */
+    bool set_duty(int val);
+    bool set_period(int val);
+    bool set_polarity(int val);
+    bool set_run(int val);
+
+private:
+    MemMap _regs;
+    std::string _device;
+    int _output;                 // 0 for A, 1 for B
+    volatile uint16_t* _cmp;     // CMPA or CMPB
+    uint32_t _countsPerNs;       // time base counts per ns, 0.32 fixed point
+    int _polarity;
+};
+
+#endif
@@ -0,0 +1,82 @@
+/*
+BSD License
+Copyright © 2013, Bence Magyar
+All rights reserved.
+Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+Neither the name of the owner nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#ifndef __MOTIONPROFILE_H_
+#define __MOTIONPROFILE_H_
+
+#include <vector>
+
+#include "motionscheduler.h"
+#include "pwmchannel.h"
+
+/**
+ * \brief Time-optimal point to point move under velocity, acceleration and jerk limits.
+ *
+ * Without a jerk limit the velocity profile is a trapezoid, with one it is an
+ * S-curve (jerk-limited acceleration ramps). Short moves that cannot reach the
+ * velocity limit get a lower peak velocity. Units are up to the caller, e.g.
+ * degrees, degrees/s, degrees/s^2 and degrees/s^3.
+ **/
+class MotionProfile
+{
+public:
+    MotionProfile();
+
+    /** Plan a move from start to target. maxJerk <= 0 means no jerk limit. */
+    void plan(double start, double target, double maxVel, double maxAccel, double maxJerk = 0);
+
+    /** Total duration of the move in seconds. */
+    double duration() const;
+
+    /** Position t seconds after the start of the move. */
+    double position(double t) const;
+
+private:
+    double accelDistance(double t) const;
+    void accelPhase(double vPeak);
+
+    double _start;
+    double _dir;
+    double _distance;
+    double _jerk;
+    double _maxAccel;
+    double _vPeak;      // cruise velocity
+    double _aPeak;      // acceleration reached
+    double _tJerk;      // duration of each jerk ramp
+    double _tAccel;     // duration of the acceleration phase
+    double _tCruise;    // duration of the constant velocity phase
+};
+
+/**
+ * \brief A precomputed list of duty values played back on a PwmChannel, one per scheduler tick.
+ **/
+class Trajectory : public MotionScheduler::Task
+{
+public:
+    Trajectory();
+
+    /** Duty values in ns, for ticks 1..n after the start. */
+    std::vector<int>& samples();
+
+    /** Play the samples on channel; *duty tracks the last value written. */
+    void start(PwmChannel* channel, int* duty);
+
+    bool tick();
+
+private:
+    std::vector<int> _samples;
+    size_t _next;
+    PwmChannel* _channel;
+    int* _duty;
+};
+
+#endif
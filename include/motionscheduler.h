@@ -0,0 +1,82 @@
+/*
+BSD License
+Copyright © 2013, Bence Magyar
+All rights reserved.
+Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+Neither the name of the owner nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#ifndef __MOTIONSCHEDULER_H_
+#define __MOTIONSCHEDULER_H_
+
+#include <atomic>
+#include <pthread.h>
+#include <vector>
+
+/**
+ * \brief A single timing thread that advances all running motions on a fixed tick.
+ *
+ * Tasks are ticked in the order they were added until their tick() returns
+ * false. The scheduler lock is not held while a task ticks, so a slow channel
+ * does not stall the threads adding and removing tasks, and remove() of a task
+ * that is not scheduled does not lock at all. The thread is started on the
+ * first add().
+ **/
+class MotionScheduler
+{
+public:
+    /** Something that moves. */
+    class Task
+    {
+    public:
+        Task() : _scheduled(false) {}
+        virtual ~Task() {}
+        /** Advance by one tick. Return false when the motion is finished. */
+        virtual bool tick() = 0;
+
+    private:
+        friend class MotionScheduler;
+        std::atomic<bool> _scheduled;   // added, not finished or removed yet
+    };
+
+    static MotionScheduler& instance();
+
+    /** Start ticking task, from the next tick on. */
+    void add(Task* task);
+    /** Stop ticking task. When this returns the task is not being ticked,
+     *  unless it is called from the task's own tick(). */
+    void remove(Task* task);
+    /** True while task is being ticked. */
+    bool active(Task* task);
+    /** Block until task is finished or removed. */
+    void wait(Task* task);
+
+    /** Tick period in nanoseconds, 20 ms (one servo frame) by default. */
+    void setTickNs(long ns);
+    long tickNs() const;
+
+private:
+    MotionScheduler();
+    MotionScheduler(const MotionScheduler&);
+    MotionScheduler& operator=(const MotionScheduler&);
+
+    static void* run(void* self);
+    void loop();
+
+    std::vector<Task*> _tasks;
+    std::vector<Task*> _ticking;    // copy of _tasks ticked without the lock
+    Task* _current;                 // being ticked
+    bool _currentAdded;             // add()ed again while being ticked
+    long _tickNs;
+    bool _started;
+    pthread_t _thread;
+    pthread_mutex_t _mutex;
+    pthread_cond_t _wake;    // tasks were added
+    pthread_cond_t _done;    // tasks finished or were removed
+};
+
+#endif
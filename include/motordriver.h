@@ -14,11 +14,19 @@ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
 
 
 
+#include <atomic>
+#include <deque>
 #include <fstream>
+#include <pthread.h>
 #include <string>
+#include <vector>
 
 #include "gpio.hpp"
+#include "encoder.h"
+#include "eventreactor.h"
+#include "gpio_port.hpp"
 #include "motorpwm.h"
+#include "odometry.h"
 /**
  * \author Bence Magyar
  * \year 2013
@@ -26,22 +34,120 @@ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
  **/
 class MotorDriver
 {
+public:
+	typedef enum {FORWARD, BACKWARD, TURNLEFT, TURNRIGHT} maneuver_t;
+
+	/** Called on the driver's timer thread when maneuver id ends: completed is
+	 *  true if it ran for its whole time, false if it was preempted or stopped. */
+	typedef void (*done_callback_t)(int id, bool completed, void* arg);
+
 private:
 	MotorPwm motor1;
 	MotorPwm motor2;
 	BeagleBone::gpio* motor1dir;
 	BeagleBone::gpio* motor2dir;    
+	BeagleBone::gpio_port* dirport;	// both direction pins share a bank when mapped
+	uint32_t dirmask1;
+	uint32_t dirmask2;
+
+	struct Maneuver
+	{
+		int id;
+		maneuver_t what;
+		int milisec;
+		int dutypercent;
+		done_callback_t done;
+		void* arg;
+		uint64_t endNs;		// UINT64_MAX for untimed
+	};
+
+	EventReactor reactor;		// runs the maneuver timer
+	int timer;
+	pthread_mutex_t mutex;		// guards the maneuvers and the outputs
+	std::deque<Maneuver> queue;
+	Maneuver current;
+	bool active;
+	int nextId;
+	bool attached;		// init() done, detach() not yet
+
+	bool ramped;
+	// last level of the direction pins, -1 unknown; the ramp's reverse
+	// callbacks set them from the MotionScheduler thread
+	std::atomic<int> dir1state;
+	std::atomic<int> dir2state;
+
+	double wheelBase;		// m
+	double wheelRadius;		// m
+	double maxWheelSpeed;		// rad/s at MAX_SPEED duty
+
+	Odometry odom;
+	Encoder* encoderLeft;		// NULL: integrate the commanded speeds
+	Encoder* encoderRight;
+	double countsPerRevLeft;
+	double countsPerRevRight;
+
+	void setDirection(int dir1, int dir2);
+	static void reverse1(bool forward, void* self);
+	static void reverse2(bool forward, void* self);
+	int submit(maneuver_t what, int milisec, int dutypercent, done_callback_t done, void* arg, bool preempt);
+	void begin(Maneuver& m);
+	void halt();
+	void takeAll(std::vector<Maneuver>& cancelled);
+	static void onTimer(uint64_t expirations, uint64_t timestampNs, void* self);
 	 
 public:
     MotorDriver();
      ~MotorDriver();
-	void init();
+	/** With gpio::MMAP the direction pins flip with SETDATAOUT/CLEARDATAOUT
+	 *  stores, at most one of each, which are atomic against other writers. */
+	void init(BeagleBone::gpio::backend_t dirBackend = BeagleBone::gpio::SYSFS);
+	/** Release the outputs. Repeated calls, and the destructor after it, do nothing. */
 	void detach();
-    void forward(int milisec, int dutypercent);
-	void backward(int milisec, int dutypercent);
-	void turnleft(int milisec, int dutypercent);
-	void turnright(int milisec, int dutypercent);
-	
+
+	/** Start a maneuver now, preempting the current one and dropping the queued
+	 *  ones. Returns immediately with the maneuver id. After milisec the motors
+	 *  stop (or the next queued maneuver starts); 0 runs until preempted. */
+    int forward(int milisec, int dutypercent, done_callback_t done = NULL, void* arg = NULL);
+	int backward(int milisec, int dutypercent, done_callback_t done = NULL, void* arg = NULL);
+	int turnleft(int milisec, int dutypercent, done_callback_t done = NULL, void* arg = NULL);
+	int turnright(int milisec, int dutypercent, done_callback_t done = NULL, void* arg = NULL);
+
+	/** Run a maneuver after the current and already queued ones. Returns its id. */
+	int enqueue(maneuver_t what, int milisec, int dutypercent, done_callback_t done = NULL, void* arg = NULL);
+
+	/** Ramp both motors (percent per second, see MotorPwm::setRamp()). Maneuvers
+	 *  then set targets, the direction pins flip when a motor passes through
+	 *  0, and stop() ramps down instead of cutting the outputs. */
+	void setRamp(double upPerSec, double downPerSec, double reversalPerSec = 0);
+
+	/** Wheel base and radius in meters, and the wheel speed in rad/s at
+	 *  MAX_SPEED duty, used by setVelocity(). */
+	void setGeometry(double wheelBaseM, double wheelRadiusM, double maxWheelRadPerSec);
+
+	/** Drive at v m/s and omega rad/s (counterclockwise positive), cancelling
+	 *  any maneuver. If a wheel would exceed MAX_SPEED both are scaled down
+	 *  together, which keeps the curvature. Only the direction pins and duties
+	 *  that change are written, so it can be called every control cycle. */
+	void setVelocity(double v, double omega);
+
+	/** Wheel encoders for updateOdometry(), counts per wheel revolution,
+	 *  negative if that encoder counts down going forward. NULL, NULL goes
+	 *  back to integrating the commanded speeds. Set them before the first
+	 *  updateOdometry(). */
+	void setEncoders(Encoder* left, Encoder* right, double countsPerRevLeft, double countsPerRevRight);
+
+	/** Advance the odometry to now from the encoders, or from the speeds put
+	 *  out since the last call (which includes ramping but not slip or load).
+	 *  Call it from one thread at the control rate, e.g. a ControlLoop, and
+	 *  read odometry().pose() from anywhere. Needs setGeometry(). */
+	void updateOdometry();
+	Odometry& odometry();
+
+	/** True while a maneuver is running. */
+	bool busy();
+
+	/** Stop the motors (duty 0, the outputs stay enabled until detach()) and
+	 *  cancel the current and queued maneuvers. */
     void stop();
     	
 	std::string toString() const;
@@ -50,6 +156,4 @@ public:
      
 };
 
-#endif 
-
-
+#endif
@@ -15,6 +15,7 @@ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
 #define MAX_SPEED 78
 #define MIN_SPEED 10
 #define PWM_FREQUENCY 8000 //hz
+#define PWM_PERIOD_NS (1000000000/PWM_FREQUENCY)
 
 #define SYSFS_EHRPWM_PREFIX "/sys/class/pwm/"
 #define SYSFS_EHRPWM_SUFFIX_A ":0"
@@ -25,9 +26,14 @@ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
 #define SYSFS_EHRPWM_REQUEST "request"
 
 
+#include <atomic>
 #include <fstream>
 #include <string>
 
+#include "pins.h"
+#include "pwmchannel.h"
+#include "ramp.h"
+
 /**
  * \author Bence Magyar
  * \year 2013
@@ -35,6 +41,8 @@ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
  **/
 class MotorPwm
 {
+    friend class ServoGroup;
+
 private:
     std::string _pin;
     bool _attached;
@@ -61,29 +69,23 @@ ehrpwm.0:0
 Define files to match sysfs tree:
 */
 
-    std::ofstream _sysfsfid_duty;
-    std::ofstream _sysfsfid_period;
-    //std::ofstream _sysfsfid_polarity;
-    std::ofstream _sysfsfid_run;
-    std::fstream _sysfsfid_request;
-
-    std::string _filename_request;
-    std::string _filename_duty;
-    std::string _filename_period;
-    //std::string _filename_polarity;
-    std::string _filename_run;
+    PwmChannel _channel;
     int _duty;
-    static const int _PERIOD = PWM_FREQUENCY;
+    static const int _PERIOD = PWM_PERIOD_NS;
     int _polarity;
     int _run;
     bool forced;
-    static std::string pinToFile(const std::string& pin); 
+    Ramp _ramp;
+    std::atomic<double> _output;    // signed percent last put out, read from any thread
+    void (*_reverse)(bool forward, void* arg);
+    void* _reverseArg;
     
 		
 public:
     MotorPwm();
      ~MotorPwm();
-	void attach(const std::string& pin);
+    /** Attach to a PWM pin, e.g. "P9_14". backend selects sysfs or direct register access. */
+	void attach(const std::string& pin, PwmChannel::backend_t backend = PwmChannel::SYSFS);
     //void init();
     void write(int value);
     void writeMicroseconds(int value);
@@ -94,11 +96,61 @@ public:
 	static void enablepwm();
 	std::string toString() const;
 
+    /** Hardware writes issued and redundant writes skipped since attach. */
+    unsigned long writesIssued() const;
+    unsigned long writesElided() const;
+    /** Time taken by the hardware writes of this channel (p50/p99/max). */
+    LatencyHistogram::Stats latencyStats() const;
+    void resetLatencyStats();
+
+    /** Limit how fast the duty may change, in percent per second, from the
+     *  shared MotionScheduler thread: up when speeding up, down when slowing
+     *  down and reversal when slowing down to change direction (<= 0 uses
+     *  down). write() and setTarget() then only set the target. 0, 0 turns
+     *  the ramp off. */
+    void setRamp(double upPerSec, double downPerSec, double reversalPerSec = 0);
+    /** Signed speed in percent, negative for reverse. The sign only reaches
+     *  the motor through the onReverse() callback. */
+    void setTarget(double value);
+    double target() const;
+    /** Signed percent put out right now, the ramp's position while ramping.
+     *  Without a ramp write() and setTarget() put out the magnitude only. */
+    double output() const;
+    /** Called with the new direction when the output leaves 0, before the duty is written. */
+    void onReverse(void (*callback)(bool forward, void* arg), void* arg);
+
+protected:
+    /** Attach to the PWM device (e.g. "ehrpwm.1:0") of a pin already looked up. */
+    void attachDevice(const char* pin, const char* device, PwmChannel::backend_t backend);
+
 private:
+    int dutyFor(int value) const;
+    static void rampOutput(double value, void* self);
     void set_request(const int val); 
     void set_duty(const int val); 
     void set_period(const int val); 
     void set_run(const int val); 
 };
 
+/**
+ * \brief A MotorPwm bound to its pin at compile time, e.g. MotorPwmAt<Pins::P9_14>.
+ *
+ * The device is taken from the pin table when compiling, and a pin without a
+ * PWM output does not compile.
+ **/
+template<Pins::pin_t PIN>
+class MotorPwmAt : public MotorPwm
+{
+    static_assert(Pins::hasPwm(PIN), "this pin has no PWM output");
+
+public:
+    static constexpr const char* device() { return Pins::pwm(PIN).device; }
+    static constexpr uint32_t regBase() { return Pins::regBase(PIN); }
+
+    void attach(PwmChannel::backend_t backend = PwmChannel::SYSFS)
+    {
+        attachDevice(Pins::pwm(PIN).name, device(), backend);
+    }
+};
+
 #endif 
@@ -0,0 +1,85 @@
+/*
+BSD License
+Copyright © 2013, Bence Magyar
+All rights reserved.
+Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+Neither the name of the owner nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#ifndef __ODOMETRY_H_
+#define __ODOMETRY_H_
+
+#include <atomic>
+#include <stdint.h>
+
+/**
+ * \brief Differential-drive pose integrated from wheel travel, readable from any thread.
+ *
+ * Each update moves the pose along the exact circular arc the two wheel
+ * displacements describe, so the result does not depend on the update rate
+ * as long as the curvature is constant between updates. One thread updates,
+ * any number of threads read pose() without locking: the pose is published
+ * under a sequence counter and a reader retries if an update was in progress.
+ * Distances are in meters, angles in radians, counterclockwise positive.
+ **/
+class Odometry
+{
+public:
+    struct Pose
+    {
+        double x;
+        double y;
+        double theta;          // -pi..pi
+        double v;              // m/s over the last update
+        double omega;          // rad/s over the last update
+        uint64_t timestampNs;  // CLOCK_MONOTONIC of the last update
+    };
+
+    Odometry();
+
+    void setWheelBase(double meters);
+    /** Travel of each wheel per encoder count, negative if it counts down going forward. */
+    void setMetersPerCount(double left, double right);
+
+    /** Restart from this pose, forgetting the last encoder counts. */
+    void reset(double x = 0, double y = 0, double theta = 0);
+
+    /** Integrate absolute encoder counts. The first call after reset() only
+     *  records them. Updater thread only. */
+    void updateCounts(int32_t left, int32_t right, uint64_t timestampNs);
+    /** Integrate the wheel travel since the last update. Updater thread only. */
+    void updateTravel(double left, double right, uint64_t timestampNs);
+    /** Integrate wheel speeds (m/s) held since the last update. Updater thread only. */
+    void updateSpeeds(double left, double right, uint64_t timestampNs);
+
+    /** Consistent copy of the last pose, from any thread. */
+    Pose pose() const;
+
+private:
+    Odometry(const Odometry&);
+    Odometry& operator=(const Odometry&);
+
+    void publish(double x, double y, double theta, double v, double omega, uint64_t timestampNs);
+
+    double _wheelBase;
+    double _metersPerCountLeft;
+    double _metersPerCountRight;
+
+    // updater thread only
+    bool _haveCounts;
+    int32_t _left;
+    int32_t _right;
+    double _x, _y, _theta;
+    uint64_t _timestampNs;
+
+    // seqlock: odd while an update is being published
+    std::atomic<uint32_t> _seq;
+    std::atomic<double> _pubX, _pubY, _pubTheta, _pubV, _pubOmega;
+    std::atomic<uint64_t> _pubTimestampNs;
+};
+
+#endif
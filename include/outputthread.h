@@ -0,0 +1,97 @@
+/*
+BSD License
+Copyright © 2013, Bence Magyar
+All rights reserved.
+Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+Neither the name of the owner nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#ifndef __OUTPUTTHREAD_H_
+#define __OUTPUTTHREAD_H_
+
+#include <atomic>
+#include <vector>
+
+#include "commandqueue.h"
+#include "controlloop.h"
+#include "gpio.hpp"
+#include "motorpwm.h"
+#include "servo.h"
+
+/**
+ * \brief A thread that owns the output handles and applies queued setpoints to them.
+ *
+ * Application threads post {channel, value} commands without blocking on the
+ * hardware: post() goes through a lock-free MPSC queue usable from any thread,
+ * and a thread that wants a wait-free path can get its own SPSC lane with
+ * addProducer(). Every period the output thread drains all queues in order and
+ * applies the commands: degrees for a Servo, duty percent for a MotorPwm, 0/1
+ * for a gpio. Once registered, handles must only be used by the output thread.
+ **/
+class OutputThread
+{
+public:
+    typedef SpscQueue<Command, 256> Lane;
+    typedef MpscQueue<Command, 1024> Queue;
+
+    explicit OutputThread(int64_t periodNs = 1000000);
+    ~OutputThread();
+
+    /** The queue is cache line aligned, which C++11 new does not honour. */
+    static void* operator new(size_t size);
+    static void operator delete(void* ptr);
+
+    /** Register a handle, before start(). Returns its channel number. */
+    int addServo(Servo* servo);
+    int addMotor(MotorPwm* motor);
+    int addGpio(BeagleBone::gpio* pin);
+
+    /** A dedicated wait-free queue for one producer thread, before start(). */
+    Lane* addProducer();
+
+    /** Queue a command from any thread. Returns false if it was dropped. */
+    bool post(int channel, int value);
+    /** Queue a command on a producer lane. Returns false if it was dropped. */
+    static bool post(Lane* lane, int channel, int value);
+
+    /** The loop running the thread, to set its priority or CPU before start(). */
+    ControlLoop& loop();
+    bool start();
+    void stop();
+
+    /** Commands waiting, dropped because a queue was full, and applied. */
+    size_t depth() const;
+    unsigned long drops() const;
+    unsigned long applied() const;
+    /** Longest time between posting and applying a command. */
+    long maxLatencyNs() const;
+
+private:
+    OutputThread(const OutputThread&);
+    OutputThread& operator=(const OutputThread&);
+
+    struct Output
+    {
+        Servo* servo;
+        MotorPwm* motor;
+        BeagleBone::gpio* pin;
+    };
+
+    int add(Servo* servo, MotorPwm* motor, BeagleBone::gpio* pin);
+    static void cycle(void* self);
+    void apply(const Command& cmd);
+
+    std::vector<Output> _outputs;
+    std::vector<Lane*> _lanes;
+    Queue _queue;
+    ControlLoop _loop;
+
+    std::atomic<unsigned long> _applied;
+    std::atomic<long> _maxLatencyNs;
+};
+
+#endif
@@ -0,0 +1,115 @@
+/*
+BSD License
+Copyright © 2013, Bence Magyar
+All rights reserved.
+Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+Neither the name of the owner nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#ifndef __PIDENGINE_H_
+#define __PIDENGINE_H_
+
+#include <atomic>
+#include <deque>
+#include <vector>
+
+#include "controlloop.h"
+#include "motorpwm.h"
+#include "servo.h"
+
+/**
+ * \brief Fixed-rate PID controllers for many axes, updated together on one ControlLoop thread.
+ *
+ * Gains and state are kept per field in contiguous float arrays, so the
+ * update of all axes is one branch-free loop the compiler can vectorize
+ * (NEON on the BeagleBone is single precision, hence float). Each tick reads
+ * every axis' feedback, runs that loop, and writes the outputs: signed duty
+ * percent through MotorPwm::setTarget() or degrees written straight to the
+ * servo's PwmChannel. addServo() cancels any Servo::moveTo() motion once, so
+ * the engine thread never takes the MotionScheduler lock for a servo axis.
+ *
+ * The derivative acts on the filtered measurement, so setpoint steps do not
+ * kick it. Outputs are clamped to the axis limits and the integrator is
+ * corrected by the clamped excess (back-calculation anti-windup). A non-zero
+ * output smaller than the deadband is raised to it, e.g. MIN_SPEED for a
+ * motor that does not turn below it. Once registered, the handles must only
+ * be used by the engine thread.
+ **/
+class PidEngine
+{
+public:
+    /** Measurement of an axis, read once per tick on the engine thread. */
+    typedef float (*feedback_t)(void* arg);
+
+    explicit PidEngine(int64_t periodNs = 10000000);
+    ~PidEngine();
+
+    /** Register an axis, before start(). Returns its number. Motor axes are
+     *  limited to +-MAX_SPEED with a MIN_SPEED deadband, servo axes to 0..180. */
+    int addMotor(MotorPwm* motor, feedback_t feedback, void* arg);
+    int addServo(Servo* servo, feedback_t feedback, void* arg);
+    /** An axis without an actuator, its output is only read with output(). */
+    int addAxis(feedback_t feedback, void* arg);
+
+    /** kff multiplies the setpoint (feedforward). Before start(). */
+    void setGains(int axis, float kp, float ki, float kd, float kff = 0);
+    /** Time constant of the derivative low-pass filter, 0 for none. Before start(). */
+    void setDerivativeFilter(int axis, float tauSec);
+    void setLimits(int axis, float outMin, float outMax, float deadband = 0);
+
+    /** Set the target of an axis, from any thread. It is taken by the next
+     *  step(); update() alone works on the setpoints in setpoints(). */
+    void setSetpoint(int axis, float setpoint);
+    float output(int axis) const;
+    size_t axes() const;
+
+    /** One tick: read feedback, update, write outputs. start() calls it every period. */
+    void step();
+    /** The update of all axes from setpoints() and measurement(), without I/O. */
+    void update();
+    float* setpoints();
+    float* measurement();
+
+    /** Clear integrators and derivative state, e.g. after the motors were stopped. */
+    void reset();
+
+    /** The loop running the thread, to set its priority or CPU before start(). */
+    ControlLoop& loop();
+    bool start();
+    void stop();
+
+private:
+    PidEngine(const PidEngine&);
+    PidEngine& operator=(const PidEngine&);
+
+    struct Binding
+    {
+        MotorPwm* motor;
+        Servo* servo;
+        feedback_t feedback;
+        void* arg;
+    };
+
+    int add(MotorPwm* motor, Servo* servo, feedback_t feedback, void* arg,
+            float outMin, float outMax, float deadband);
+    static void cycle(void* self);
+
+    const float _dt;
+    std::vector<Binding> _bindings;
+    std::deque<std::atomic<float> > _target;     // written by any thread, never moved
+
+    // one entry per axis
+    std::vector<float> _kp, _ki, _kd, _kff;
+    std::vector<float> _alpha;          // derivative filter coefficient
+    std::vector<float> _min, _max, _deadband;
+    std::vector<float> _setpoint, _measurement, _previous;
+    std::vector<float> _integral, _derivative, _output;
+
+    ControlLoop _loop;
+};
+
+#endif
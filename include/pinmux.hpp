@@ -20,13 +20,21 @@
 #ifndef __BONELIB_PINMUX__
 #define __BONELIB_PINMUX__
 
+#include <stddef.h>
+
 namespace BeagleBone {
 
 class pin_fct;
+struct pin_table;
 
 /** Class representing a physical pin */
 class pin
 {
+  friend class pin_fct;
+  friend struct pin_table;
+  friend class board;
+  friend class gpio;
+
 public:
   typedef enum {IN, OUT} direction_t;
   typedef enum {NONE, PU, PD} pull_t;
@@ -63,36 +71,64 @@ private:
   static pin* m_P8[46];
   static pin* m_P9[46];
 
-  const char* m_name;
-  char*       m_dev;
-  pin_fct*    m_fct;
-  pin_fct*    m_gpio;
-  const char* m_locker;
-  int         m_key;
+  const char*    m_name;
+  const char*    m_dev;
+  pin_fct*       m_fct;
+  pin_fct* const m_modes[8];
+  const char*    m_locker;
+  int            m_key;
+  int            m_code;
 
 protected:
-  pin(const char*    name,
-      const char*    dev,
-      pin_fct* const mode0,
-      pin_fct* const mode1,
-      pin_fct* const mode2,
-      pin_fct* const mode3,
-      pin_fct* const mode4,
-      pin_fct* const mode5,
-      pin_fct* const mode6,
-      pin_fct* const mode7,
-      int            init,
-      direction_t    dir = IN,
-      pull_t         pulls = NONE);
+  /** Pins are constant-initialized: the constructor only stores its arguments.
+   *  The debugfs path of the mux is built when the pin is muxed.
+   */
+  constexpr pin(const char*    name,
+		const char*    dev,
+		pin_fct* const mode0,
+		pin_fct* const mode1,
+		pin_fct* const mode2,
+		pin_fct* const mode3,
+		pin_fct* const mode4,
+		pin_fct* const mode5,
+		pin_fct* const mode6,
+		pin_fct* const mode7,
+		int            init,
+		direction_t    dir = IN,
+		pull_t         pulls = NONE)
+    // ToDo: Detect actual current mux setting
+    : m_name(name), m_dev(dev),
+      m_fct(init == 0 ? mode0 : init == 1 ? mode1 : init == 2 ? mode2 : init == 3 ? mode3 :
+	    init == 4 ? mode4 : init == 5 ? mode5 : init == 6 ? mode6 : mode7),
+      m_modes{mode0, mode1, mode2, mode3, mode4, mode5, mode6, mode7},
+      m_locker(NULL), m_key(0), m_code(-1)
+  {
+  }
 
 private:
-  void m_pin_can_do(pin_fct* const fct, unsigned char mode);
+  /** Mode carrying fct on this pin, -1 if it cannot */
+  int m_mode_of(pin_fct* fct);
+
+  /** Pin i of P8 (0..45) then P9 (46..91) */
+  static pin* m_all(int i);
+
+  /** Value written to the mux for a mode, direction and pulls */
+  static int m_mux_code(int mode, direction_t dir, pull_t pulls);
+
+  /** Path of the debugfs mux file of this pin */
+  void m_path(char* buf, size_t len);
+
+  /** Current mux value: last one written, else read back from debugfs
+   *  (once). Returns -1 if unknown.
+   */
+  int m_read_code();
 };
 
 /** Class representing the functionality of a pin */
 class pin_fct {
 
   friend class pin;
+  friend struct pin_table;
 
 public:
 
@@ -353,17 +389,16 @@ public:
   virtual pin* xport(pin::direction_t dir = pin::IN, pin::pull_t pulls = pin::NONE);
 
 private:
-  /* Pins that CAN be muxed with this function */
-  pin*          m_pins[4];
-  unsigned char m_mode[4];
-
-  /* Pin currently muxed with this functionality */
-  pin* m_pin;
-
   const char* m_name;
 
 protected:
-  pin_fct(const char* name);
+  /** The pins that can carry or currently carry a function are found from the
+   *  pin table, so a function is only its name.
+   */
+  constexpr pin_fct(const char* name)
+    : m_name(name)
+  {
+  }
 };
 
 }
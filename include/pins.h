@@ -0,0 +1,140 @@
+/*
+BSD License
+Copyright © 2013, Bence Magyar
+All rights reserved.
+Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+Neither the name of the owner nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#ifndef __PINS_H_
+#define __PINS_H_
+
+#include <stdint.h>
+#include <string>
+
+/**
+ * \brief Compile-time database of the BeagleBone header pins that carry a PWM output.
+ *
+ * Pins are numbered P8_1..P8_46 then P9_1..P9_46, so a pin name parses to its
+ * number with a little arithmetic. The constexpr lookups let ServoAt and
+ * MotorPwmAt check and resolve their pin at compile time; the string API
+ * (Servo::attach("P9_14")) uses the same table through findPwm().
+ **/
+namespace Pins
+{
+
+typedef enum
+{
+    P8_1, P8_2, P8_3, P8_4, P8_5, P8_6, P8_7, P8_8, P8_9, P8_10, P8_11, P8_12,
+    P8_13, P8_14, P8_15, P8_16, P8_17, P8_18, P8_19, P8_20, P8_21, P8_22, P8_23,
+    P8_24, P8_25, P8_26, P8_27, P8_28, P8_29, P8_30, P8_31, P8_32, P8_33, P8_34,
+    P8_35, P8_36, P8_37, P8_38, P8_39, P8_40, P8_41, P8_42, P8_43, P8_44, P8_45,
+    P8_46,
+    P9_1, P9_2, P9_3, P9_4, P9_5, P9_6, P9_7, P9_8, P9_9, P9_10, P9_11, P9_12,
+    P9_13, P9_14, P9_15, P9_16, P9_17, P9_18, P9_19, P9_20, P9_21, P9_22, P9_23,
+    P9_24, P9_25, P9_26, P9_27, P9_28, P9_29, P9_30, P9_31, P9_32, P9_33, P9_34,
+    P9_35, P9_36, P9_37, P9_38, P9_39, P9_40, P9_41, P9_42, P9_43, P9_44, P9_45,
+    P9_46,
+    COUNT
+} pin_t;
+
+struct PwmPin
+{
+    pin_t pin;
+    const char* name;
+    const char* device;     // sysfs device name
+    int module;             // PWMSS instance
+    int output;             // 0 for output A, 1 for output B
+    bool ecap;              // eCAP used as PWM instead of an EHRPWM output
+    const char* fct;        // pinmux function, as in BeagleBone::pin_fct
+};
+
+constexpr uint32_t PWMSS_BASE[3] = {0x48300000, 0x48302000, 0x48304000};
+constexpr uint32_t ECAP_OFFSET = 0x100;
+constexpr uint32_t EQEP_OFFSET = 0x180;
+constexpr uint32_t EHRPWM_OFFSET = 0x200;
+
+constexpr PwmPin PWM_PINS[] =
+{
+    {P8_13, "P8_13", "ehrpwm.2:1", 2, 1, false, "ehrpwm2B"},
+    {P8_19, "P8_19", "ehrpwm.2:0", 2, 0, false, "ehrpwm2A"},
+    {P9_14, "P9_14", "ehrpwm.1:0", 1, 0, false, "ehrpwm1A"},
+    {P9_16, "P9_16", "ehrpwm.1:1", 1, 1, false, "ehrpwm1B"},
+    {P9_31, "P9_31", "ehrpwm.0:0", 0, 0, false, "ehrpwm0A"},
+    {P9_29, "P9_29", "ehrpwm.0:1", 0, 1, false, "ehrpwm0B"},
+    {P9_42, "P9_42", "ecap.0",     0, 0, true,  "ecap0_in_pwm0_out"},
+    {P9_28, "P9_28", "ecap.2",     2, 0, true,  "ecap2_in_pwm2_out"},
+};
+
+constexpr int PWM_PIN_COUNT = sizeof(PWM_PINS) / sizeof(PWM_PINS[0]);
+
+/** Index of pin in PWM_PINS, -1 if it has no PWM output. */
+constexpr int pwmSlot(pin_t pin, int i = 0)
+{
+    return i == PWM_PIN_COUNT ? -1 : PWM_PINS[i].pin == pin ? i : pwmSlot(pin, i + 1);
+}
+
+// pwmSlot() of every pin, computed at compile time so findPwm() is an index
+template<int... I> struct PinSeq {};
+template<int N, int... I> struct MakePinSeq : MakePinSeq<N - 1, N - 1, I...> {};
+template<int... I> struct MakePinSeq<0, I...> { typedef PinSeq<I...> type; };
+
+template<class S> struct PwmSlotTable;
+template<int... I> struct PwmSlotTable<PinSeq<I...> >
+{
+    static constexpr signed char slots[sizeof...(I)] = {(signed char)pwmSlot((pin_t)I)...};
+};
+template<int... I> constexpr signed char PwmSlotTable<PinSeq<I...> >::slots[sizeof...(I)];
+
+typedef PwmSlotTable<MakePinSeq<COUNT>::type> PwmSlots;
+
+constexpr bool hasPwm(pin_t pin)
+{
+    return pwmSlot(pin) >= 0;
+}
+
+constexpr const PwmPin& pwm(pin_t pin)
+{
+    return PWM_PINS[pwmSlot(pin)];
+}
+
+/** Physical address of the EHRPWM or eCAP registers driving pin. */
+constexpr uint32_t regBase(pin_t pin)
+{
+    return PWMSS_BASE[pwm(pin).module] + (pwm(pin).ecap ? ECAP_OFFSET : EHRPWM_OFFSET);
+}
+
+/** Pin number of a name like "P9_14", COUNT if it is not a header pin. */
+inline pin_t fromName(const std::string& name)
+{
+    const size_t len = name.size();
+    if(len < 4 || len > 5 || name[0] != 'P' || (name[1] != '8' && name[1] != '9') || name[2] != '_')
+        return COUNT;
+
+    int n = 0;
+    for(size_t i = 3; i < len; ++i)
+    {
+        if(name[i] < '0' || name[i] > '9')
+            return COUNT;
+        n = n * 10 + name[i] - '0';
+    }
+    if(n < 1 || n > 46)
+        return COUNT;
+    return (pin_t)((name[1] - '8') * 46 + n - 1);
+}
+
+/** PWM entry of the pin called name, NULL if there is none. */
+inline const PwmPin* findPwm(const std::string& name)
+{
+    const pin_t pin = fromName(name);
+    const int slot = pin == COUNT ? -1 : PwmSlots::slots[pin];
+    return slot < 0 ? NULL : &PWM_PINS[slot];
+}
+
+}
+
+#endif
@@ -0,0 +1,39 @@
+/*
+BSD License
+Copyright © 2013, Bence Magyar
+All rights reserved.
+Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+Neither the name of the owner nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#ifndef __PWMBACKEND_H_
+#define __PWMBACKEND_H_
+
+#include <string>
+
+/**
+ * \brief Low level access to one PWM output, used by PwmChannel.
+ *
+ * Durations are in nanoseconds. Implementations report failures on std::cerr
+ * and return false.
+ **/
+class PwmBackend
+{
+public:
+    virtual ~PwmBackend() {}
+
+    /** Request status of the device, e.g. "ehrpwm.1:0 is free". */
+    virtual std::string requestStatus() const = 0;
+
+    virtual bool set_request(int val) = 0;
+    virtual bool set_duty(int val) = 0;
+    virtual bool set_period(int val) = 0;
+    virtual bool set_polarity(int val) = 0;
+    virtual bool set_run(int val) = 0;
+};
+
+#endif
@@ -0,0 +1,95 @@
+/*
+BSD License
+Copyright © 2013, Bence Magyar
+All rights reserved.
+Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+Neither the name of the owner nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#ifndef __PWMCHANNEL_H_
+#define __PWMCHANNEL_H_
+
+#include <atomic>
+#include <string>
+
+#include "latencyhistogram.h"
+#include "pwmbackend.h"
+#include "tracering.h"
+
+/**
+ * \brief One PWM output (e.g. ehrpwm.1:0) as used by Servo and MotorPwm.
+ *
+ * The output is driven either through sysfs, where the attribute files are
+ * opened once and each update is a single pwrite, or by writing the EHRPWM
+ * registers directly. Durations are in nanoseconds.
+ * The last value committed to duty, period, polarity and run is shadowed and
+ * writes of an unchanged value are skipped. The shadows are plain ints, so
+ * the writes must come from one thread at a time (Servo and MotorPwm cancel
+ * their scheduled motion before writing themselves); the write counters may
+ * be read from any thread. The writes that reach the device are recorded in
+ * the TraceRing under the device name.
+ **/
+class PwmChannel
+{
+public:
+    typedef enum {SYSFS, MMAP} backend_t;
+
+    PwmChannel();
+    ~PwmChannel();
+
+    /** Open the PWM device (e.g. "ehrpwm.1:0") through the given backend.
+     *  MMAP falls back to SYSFS when the registers cannot be mapped.
+     */
+    bool open(const std::string& device, backend_t backend = SYSFS);
+    void close();
+    bool isOpen() const;
+
+    /** Backend actually in use after open(). */
+    backend_t backend() const;
+
+    /** Request status of the device, e.g. "ehrpwm.1:0 is free". */
+    std::string requestStatus() const;
+
+    bool set_request(int val);
+    bool set_duty(int val);
+    bool set_period(int val);
+    bool set_polarity(int val);
+    bool set_run(int val);
+
+    /** Forget the shadowed values so the next writes always reach the device. */
+    void invalidate();
+
+    /** Number of attribute writes issued to / skipped on the device. */
+    unsigned long writesIssued() const;
+    unsigned long writesElided() const;
+    void resetWriteCounters();
+
+    /** Time taken by the writes that reached the device. */
+    LatencyHistogram::Stats latencyStats() const;
+    void resetLatencyStats();
+
+private:
+    PwmChannel(const PwmChannel&);
+    PwmChannel& operator=(const PwmChannel&);
+
+    bool write(bool (PwmBackend::*set)(int), TraceRing::op_t op, int& shadow, int val);
+
+    PwmBackend* _backend;
+    backend_t _backendType;
+
+    int _shadow_duty;
+    int _shadow_period;
+    int _shadow_polarity;
+    int _shadow_run;
+
+    std::atomic<unsigned long> _issued;
+    std::atomic<unsigned long> _elided;
+    LatencyHistogram _latency;
+    uint16_t _trace;
+};
+
+#endif
@@ -0,0 +1,66 @@
+/*
+BSD License
+Copyright © 2013, Bence Magyar
+All rights reserved.
+Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+Neither the name of the owner nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#ifndef __RAMP_H_
+#define __RAMP_H_
+
+#include <atomic>
+
+#include "motionscheduler.h"
+
+/**
+ * \brief Slew-rate limiter that moves a signed output toward a target, one scheduler tick at a time.
+ *
+ * Moving away from zero is limited to the up rate and moving toward zero to
+ * the down rate. When the target has the other sign the output first goes
+ * to exactly zero at the reversal rate, then speeds up the other way. A tick
+ * is a constant amount of work, so one MotionScheduler thread can ramp many
+ * outputs. Rates are in units per second; a rate <= 0 means no limit.
+ **/
+class Ramp : public MotionScheduler::Task
+{
+public:
+    typedef void (*output_t)(double value, void* arg);
+
+    Ramp();
+
+    /** A reversal rate <= 0 uses the down rate. */
+    void setRates(double upPerSec, double downPerSec, double reversalPerSec = 0);
+    /** False when neither rate is limited: setTarget() then jumps. */
+    bool enabled() const;
+
+    /** Called on the scheduler thread with every new output value. */
+    void setOutput(output_t output, void* arg);
+
+    /** Ramp toward target from any thread. Returns at once. */
+    void setTarget(double target);
+    /** Stop ramping and set the output to value without calling the output. */
+    void reset(double value);
+
+    double target() const;
+    double current() const;
+
+    bool tick();
+
+private:
+    static double toward(double from, double to, double step);
+
+    std::atomic<double> _target;
+    std::atomic<double> _current;    // written on the scheduler thread only
+    double _up;
+    double _down;
+    double _reversal;
+    output_t _output;
+    void* _arg;
+};
+
+#endif
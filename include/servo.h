@@ -16,6 +16,7 @@ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
 #define MAX_DUTY_NS 2000000
 #define PWM_FRECUENCY 50 //hz 
 #define DEGREE_TO_NS (MAX_DUTY_NS-MIN_DUTY_NS)/180
+#define PERIOD_NS (1000000000/PWM_FRECUENCY)
 
 #define SYSFS_EHRPWM_PREFIX "/sys/class/pwm/"
 #define SYSFS_EHRPWM_SUFFIX_A ":0"
@@ -28,6 +29,11 @@ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
 #include <fstream>
 #include <string>
 
+#include "motionprofile.h"
+#include "pins.h"
+#include "pwmchannel.h"
+#include "servocalibration.h"
+
 /**
  * \author Bence Magyar
  * \year 2013
@@ -35,6 +41,9 @@ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
  **/
 class Servo
 {
+    friend class ServoGroup;
+    friend class PidEngine;
+
 private:
     std::string _pin;
     bool _attached;
@@ -61,43 +70,89 @@ ehrpwm.0:0
 Define files to match sysfs tree:
 */
 
-    std::ofstream _sysfsfid_duty;
-    std::ofstream _sysfsfid_period;
-    //std::ofstream _sysfsfid_polarity;
-    std::ofstream _sysfsfid_run;
-    std::fstream _sysfsfid_request;
-
-    std::string _filename_request;
-    std::string _filename_duty;
-    std::string _filename_period;
-    //std::string _filename_polarity;
-    std::string _filename_run;
+    PwmChannel _channel;
+    Trajectory _trajectory;
+    ServoCalibration _calibration;
+    PulseTable _table;
     int _duty;
-    static const int _PERIOD = PWM_FRECUENCY;
+    static const int _PERIOD = PERIOD_NS;
     int _polarity;
     int _run;
    
-    static std::string pinToFile(const std::string& pin); 
      
 public:
     Servo();
      ~Servo();
 
-    void attach(const std::string& pin);
+    /** Attach to a PWM pin, e.g. "P9_14". backend selects sysfs or direct register access. */
+    void attach(const std::string& pin, PwmChannel::backend_t backend = PwmChannel::SYSFS);
     void write(int value);
+    /** Write a fractional angle (degrees), converted through the calibration. */
+    void write(double angle);
     void writeMicroseconds(int value);
+
+    /** Move to angle (degrees) with limited velocity (deg/s), acceleration (deg/s^2)
+     *  and optionally jerk (deg/s^3). Returns immediately, the motion is played
+     *  by the shared MotionScheduler thread. A write() cancels a running motion.
+     */
+    void moveTo(double angle, double maxVel, double maxAccel, double maxJerk = 0);
+    bool isMoving();
+    /** Block until the current motion is finished. */
+    void wait();
+
     int read() const;
     bool attached() const;
     void stop();
     void detach();
 
+    /** Pulse widths of this servo model. The conversion table is rebuilt
+     *  at attach, or right away when already attached.
+     */
+    void calibrate(const ServoCalibration& calibration);
+    const ServoCalibration& calibration() const;
+
+    static void enablepwm();
     std::string toString() const;
 
+    /** Hardware writes issued and redundant writes skipped since attach. */
+    unsigned long writesIssued() const;
+    unsigned long writesElided() const;
+    /** Time taken by the hardware writes of this channel (p50/p99/max). */
+    LatencyHistogram::Stats latencyStats() const;
+    void resetLatencyStats();
+
+protected:
+    /** Attach to the PWM device (e.g. "ehrpwm.1:0") of a pin already looked up. */
+    void attachDevice(const char* pin, const char* device, PwmChannel::backend_t backend);
+
 private:
+    int dutyFor(double angle) const;
+    void cancelMotion();
     void set_request(const int val); 
     void set_duty(const int val); 
     void set_period(const int val); 
     void set_run(const int val); 
 };
 
+/**
+ * \brief A Servo bound to its pin at compile time, e.g. ServoAt<Pins::P9_14>.
+ *
+ * The device is taken from the pin table when compiling, and a pin without a
+ * PWM output does not compile.
+ **/
+template<Pins::pin_t PIN>
+class ServoAt : public Servo
+{
+    static_assert(Pins::hasPwm(PIN), "this pin has no PWM output");
+
+public:
+    static constexpr const char* device() { return Pins::pwm(PIN).device; }
+    static constexpr uint32_t regBase() { return Pins::regBase(PIN); }
+
+    void attach(PwmChannel::backend_t backend = PwmChannel::SYSFS)
+    {
+        attachDevice(Pins::pwm(PIN).name, device(), backend);
+    }
+};
+
 #endif 
@@ -0,0 +1,85 @@
+/*
+BSD License
+Copyright © 2013, Bence Magyar
+All rights reserved.
+Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+Neither the name of the owner nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#ifndef __SERVOCALIBRATION_H_
+#define __SERVOCALIBRATION_H_
+
+#include <stdint.h>
+#include <vector>
+
+/**
+ * \brief Pulse widths of one servo model.
+ *
+ * The defaults are the MIN_DUTY_NS..MAX_DUTY_NS range over 180 degrees that
+ * used to be hard-coded. Correction points measured on the servo bend the
+ * otherwise linear angle to pulse curve; they are interpolated linearly.
+ **/
+struct ServoCalibration
+{
+    struct Point
+    {
+        double angle;
+        int pulseNs;
+    };
+
+    ServoCalibration();
+
+    /** Pulse measured to reach angle, between the two endpoints. */
+    void addPoint(double angle, int pulseNs);
+
+    int minPulseNs;             // pulse at 0 degrees
+    int maxPulseNs;             // pulse at rangeDeg
+    double rangeDeg;
+    int centerTrimNs;           // added to every pulse
+    bool reversed;              // 0 degrees is the maxPulseNs end
+    std::vector<Point> points;
+};
+
+/**
+ * \brief Angle to pulse conversion precomputed from a ServoCalibration.
+ *
+ * The range is split into SEGMENTS equal parts. The angle is scaled to a
+ * 16.16 fixed-point segment index and the pulse interpolated from the start
+ * and slope of its segment: one multiply-add, clamping without branches, no
+ * allocation.
+ **/
+class PulseTable
+{
+public:
+    static const int SEGMENTS = 256;
+
+    PulseTable();
+
+    void build(const ServoCalibration& cal);
+
+    /** Pulse width in ns for angle (degrees), clamped to the calibrated range. */
+    inline int pulseNs(double angle) const
+    {
+        double x = angle * _scale;
+        x = x < 0 ? 0 : x;
+        x = x > (SEGMENTS << 16) ? (SEGMENTS << 16) : x;
+        const int32_t q = (int32_t)x;
+        const int i = q >> 16;
+        return _base[i] + (int)(((int64_t)_step[i] * (q & 0xffff)) >> 16);
+    }
+
+    /** Angle the pulse corresponds to, the inverse of pulseNs(). */
+    double angleFor(int pulse) const;
+
+private:
+    double _scale;              // segments per degree, 16.16
+    double _rangeDeg;
+    int32_t _base[SEGMENTS + 1];
+    int32_t _step[SEGMENTS + 1];
+};
+
+#endif
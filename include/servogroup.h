@@ -0,0 +1,83 @@
+/*
+BSD License
+Copyright © 2013, Bence Magyar
+All rights reserved.
+Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+Neither the name of the owner nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#ifndef __SERVOGROUP_H_
+#define __SERVOGROUP_H_
+
+#include <string>
+#include <vector>
+
+#include "servo.h"
+#include "motorpwm.h"
+
+/**
+ * \brief A set of Servo and MotorPwm channels updated together, frame by frame.
+ *
+ * Setpoints are staged into a back buffer with stage() and converted to duty
+ * values right away, so commit() is a single tight pass of duty writes over all
+ * channels. Channels whose duty did not change are skipped by the channel's
+ * shadow values. A MotorPwm with a ramp (MotorPwm::setRamp()) gets its staged
+ * value as the ramp target instead. The group is not thread safe: stage and commit from one thread.
+ **/
+class ServoGroup
+{
+public:
+    ServoGroup();
+    ~ServoGroup();
+
+    /** Create and attach a channel owned by the group.
+     *  Its index for stage() is the number of channels added before it.
+     */
+    Servo& addServo(const std::string& pin, PwmChannel::backend_t backend = PwmChannel::SYSFS);
+    MotorPwm& addMotor(const std::string& pin, PwmChannel::backend_t backend = PwmChannel::SYSFS);
+
+    int size() const;
+
+    /** Stage a setpoint for the next frame: degrees for a Servo, duty percent for a MotorPwm. */
+    void stage(int index, int value);
+    /** Stage a setpoint in microseconds (Servo channels only). */
+    void stageMicroseconds(int index, int value);
+
+    /** Write the staged frame to all channels. Unstaged channels keep their previous setpoint. */
+    void commit();
+
+    /** Time between the first and last channel write of the last commit, in nanoseconds. */
+    long lastCommitNs() const;
+    /** Largest commit duration seen so far, in nanoseconds. */
+    long maxCommitNs() const;
+
+    std::string toString() const;
+
+private:
+    ServoGroup(const ServoGroup&);
+    ServoGroup& operator=(const ServoGroup&);
+
+    struct Member
+    {
+        Servo* servo;
+        MotorPwm* motor;
+        PwmChannel* channel;
+    };
+
+    void add(Servo* servo, MotorPwm* motor, PwmChannel* channel);
+
+    std::vector<Member> _members;
+    // duty and user value of each channel, [_back] is being staged
+    std::vector<int> _duty[2];
+    std::vector<int> _value[2];
+    int _back;
+
+    long _lastCommitNs;
+    long _maxCommitNs;
+};
+
+#endif
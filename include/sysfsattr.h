@@ -0,0 +1,65 @@
+/*
+BSD License
+Copyright © 2013, Bence Magyar
+All rights reserved.
+Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+Neither the name of the owner nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef __SYSFSATTR_H_
+#define __SYSFSATTR_H_
+
+#include <string>
+
+/**
+ * \brief A sysfs attribute file that is opened once and kept open.
+ *
+ * Values are formatted into a stack buffer and written with a single pwrite()
+ * at offset 0, so an update costs one syscall instead of an open/write/close.
+ **/
+class SysfsAttr
+{
+public:
+    SysfsAttr();
+    ~SysfsAttr();
+
+    /** Open the attribute read-write (or write-only if it cannot be read). */
+    bool open(const std::string& path);
+    void close();
+    bool isOpen() const;
+    const std::string& path() const;
+
+    /** Write an integer value. Returns false if the write failed. */
+    bool write(int value);
+    /** Write a string value. Returns false if the write failed. */
+    bool write(const char* value);
+    /** Read the first line of the attribute (without the newline). */
+    bool read(std::string& value) const;
+
+    /** Directory the sysfs and debugfs paths are relative to, "" (the real
+     *  filesystem) by default. Set it before opening any device, e.g. to run
+     *  against a fake tree.
+     */
+    static void setRoot(const std::string& root);
+    static const std::string& root();
+
+    /** Make every write take at least ns longer, to emulate a slow device. */
+    static void setWriteDelayNs(long ns);
+
+private:
+    SysfsAttr(const SysfsAttr&);
+    SysfsAttr& operator=(const SysfsAttr&);
+
+    static void delay();
+
+    int _fd;
+    std::string _path;
+
+    static std::string _root;
+    static long _writeDelayNs;
+};
+
+#endif
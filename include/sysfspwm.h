@@ -0,0 +1,76 @@
+/*
+BSD License
+Copyright © 2013, Bence Magyar
+All rights reserved.
+Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+Neither the name of the owner nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#ifndef __SYSFSPWM_H_
+#define __SYSFSPWM_H_
+
+#include <string>
+
+#include "pwmbackend.h"
+#include "sysfsattr.h"
+
+/**
+ * \brief PWM output driven through the sysfs interface.
+ *
+ * Both the legacy layout (/sys/class/pwm/ehrpwm.1:0/duty_ns) and the pwmchip
+ * layout of newer kernels (/sys/class/pwm/pwmchipN/pwmM/duty_cycle) are
+ * supported; the layout and the chip are detected by open(). The attribute
+ * files are opened once and kept open until close(), so writes cost the same
+ * on both layouts.
+ *
+ * On the pwmchip layout a channel that is already exported but not enabled
+ * is adopted, as if open() had exported it: it is usually left over by a
+ * process that crashed before unexporting it. A channel that is enabled is
+ * reported as used by another user.
+ **/
+class SysfsPwm : public PwmBackend
+{
+public:
+    SysfsPwm();
+    ~SysfsPwm();
+
+    /** Open the attribute files of device (e.g. "ehrpwm.1:0"), exporting it if needed. */
+    bool open(const std::string& device);
+    void close();
+
+    std::string requestStatus() const;
+
+    bool set_request(int val);
+    bool set_duty(int val);
+    bool set_period(int val);
+    bool set_polarity(int val);
+    bool set_run(int val);
+
+private:
+    typedef enum {LEGACY, PWMCHIP} layout_t;
+
+    bool openLegacy(const std::string& dir);
+    bool resolveChip(const std::string& device);
+    bool openChip();
+    std::string channelDir() const;
+    bool write(SysfsAttr& attr, int val);
+
+    layout_t _layout;
+    std::string _device;
+    std::string _chip;      // pwmchipN directory, PWMCHIP layout only
+    int _index;             // channel of the chip
+    bool _exported;         // exported (or adopted) by us, to be unexported on release
+    bool _adopted;          // found exported and disabled by open()
+
+    SysfsAttr _request;
+    SysfsAttr _duty;
+    SysfsAttr _period;
+    SysfsAttr _polarity;
+    SysfsAttr _run;
+};
+
+#endif
@@ -0,0 +1,135 @@
+/*
+BSD License
+Copyright © 2013, Bence Magyar
+All rights reserved.
+Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+Neither the name of the owner nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#ifndef __TRACERING_H_
+#define __TRACERING_H_
+
+#include <atomic>
+#include <stdint.h>
+
+#include "latencyhistogram.h"
+
+/**
+ * \brief Always-on binary trace of the hardware operations, in a fixed-size ring.
+ *
+ * PwmChannel, gpio and gpio_port record every write (and gpio reads) that
+ * reaches the hardware: a timestamp, the channel, the operation, the value and
+ * how long it took. Recording claims a slot with one atomic increment and
+ * fills it with a few plain stores, from any thread, without locking; the
+ * oldest events are overwritten. The ring lives in memory until open() moves
+ * it to a shared file mapping, whose contents survive a crash of the process.
+ * tracedump prints or exports a ring file or a save()d copy.
+ * Built without WITH_TRACE, record() compiles to nothing.
+ **/
+class TraceRing
+{
+public:
+    typedef enum
+    {
+        PWM_REQUEST = 1,
+        PWM_DUTY,
+        PWM_PERIOD,
+        PWM_POLARITY,
+        PWM_RUN,
+        GPIO_SET,
+        GPIO_GET,
+        GPIO_PORT_SET,      // value is the mask of the pins driven high
+        GPIO_PORT_CLEAR     // value is the mask of the pins driven low
+    } op_t;
+
+    static const uint32_t VERSION = 1;
+    static const uint32_t DEFAULT_CAPACITY = 4096;
+    static const uint32_t MAX_CHANNELS = 64;
+    static const uint32_t NAME_LEN = 24;
+
+    static const uint8_t FAILED = 1;
+
+    // The layout is the file format, the same on the board and on a PC.
+    struct Event
+    {
+        std::atomic<uint32_t> seq;  // index + 1 once written, 0 while being written
+        uint16_t channel;
+        uint8_t op;                 // op_t
+        uint8_t flags;
+        uint64_t timestampNs;       // CLOCK_MONOTONIC at the start of the operation
+        int32_t value;
+        uint32_t latencyNs;
+    };
+
+    struct Header
+    {
+        char magic[8];                      // "BBTRACE"
+        uint32_t version;
+        uint32_t capacity;                  // events, a power of two
+        std::atomic<uint32_t> head;         // events recorded so far
+        std::atomic<uint32_t> channels;     // names in use, 0 is unnamed
+        char names[MAX_CHANNELS][NAME_LEN];
+    };
+
+    /** Id of the channel called name (e.g. "ehrpwm.1:0" or "P9_15"), registering
+     *  it on first use. 0 when the name table is full. */
+    static uint16_t channel(const char* name);
+
+    /** Append an event. */
+    static inline void record(uint16_t channel, op_t op, int32_t value, uint64_t timestampNs,
+                              uint64_t latencyNs, bool ok = true)
+    {
+#ifdef WITH_TRACE
+        Header* h = _ring.load(std::memory_order_acquire);
+        const uint32_t i = h->head.fetch_add(1, std::memory_order_relaxed);
+        Event& e = events(h)[i & (h->capacity - 1)];
+        e.seq.store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        e.channel = channel;
+        e.op = op;
+        e.flags = ok ? 0 : FAILED;
+        e.timestampNs = timestampNs;
+        e.value = value;
+        e.latencyNs = latencyNs > UINT32_MAX ? UINT32_MAX : (uint32_t)latencyNs;
+        e.seq.store(i + 1, std::memory_order_release);
+#else
+        (void)channel; (void)op; (void)value; (void)timestampNs; (void)latencyNs; (void)ok;
+#endif
+    }
+
+    /** Move the ring to a new file mapped shared at path, holding capacity
+     *  events (rounded up to a power of two), keeping the channel names.
+     *  Call open() and close() while nothing is recording, e.g. at startup. */
+    static bool open(const char* path, uint32_t capacity = DEFAULT_CAPACITY);
+    /** Go back to the in-memory ring. */
+    static void close();
+
+    /** Write a copy of the ring to path. */
+    static bool save(const char* path);
+
+    static uint32_t size(const Header* h)
+    {
+        return sizeof(Header) + h->capacity * sizeof(Event);
+    }
+
+    static Event* events(Header* h)
+    {
+        return (Event*)(h + 1);
+    }
+
+    static const Event* events(const Header* h)
+    {
+        return (const Event*)(h + 1);
+    }
+
+private:
+    TraceRing();
+
+    static std::atomic<Header*> _ring;
+};
+
+#endif
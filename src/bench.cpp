@@ -0,0 +1,392 @@
+#include "encoder.h"
+#include "memmap.h"
+#include "motordriver.h"
+#include "pidengine.h"
+#include "servo.h"
+#include "sysfsattr.h"
+#include "tracering.h"
+#include <algorithm>
+#include <sstream>
+#include <vector>
+#include <ftw.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+/*
+ * Measures the library against a fake sysfs tree built in a temporary
+ * directory, so it runs on any Linux machine without a BeagleBone.
+ *
+ * usage: bench [iterations] [write delay in us]
+ *
+ * The write delay is added to every PWM attribute write to emulate a slow
+ * device. The fake tree is a plain directory, so the numbers are the cost of
+ * the library and the syscalls, not of the PWM driver. Register access goes
+ * to a sparse file standing in for /dev/mem. The trace ring is mapped to a
+ * file in the tree, as it would be on the board.
+ */
+
+static const char* pwm_devices[] = {"ehrpwm.0:0", "ehrpwm.0:1", "ehrpwm.1:0", "ehrpwm.1:1",
+                                    "ehrpwm.2:0", "ehrpwm.2:1", "ecap.0", "ecap.2"};
+
+static std::string root;
+
+static uint64_t now_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+static void mkdirs(const std::string& path)
+{
+    for(size_t i = 1; i <= path.size(); ++i)
+        if(i == path.size() || path[i] == '/')
+            mkdir(path.substr(0, i).c_str(), 0755);
+}
+
+static void mkfile(const std::string& path, const std::string& content)
+{
+    FILE* fp = fopen(path.c_str(), "w");
+    if(fp == NULL)
+    {
+        perror(path.c_str());
+        exit(1);
+    }
+    fputs(content.c_str(), fp);
+    fclose(fp);
+}
+
+static std::string readLine(const std::string& path)
+{
+    char buf[64] = "";
+    FILE* fp = fopen(path.c_str(), "r");
+    if(fp)
+    {
+        if(fgets(buf, sizeof(buf), fp) == NULL)
+            buf[0] = '\0';
+        fclose(fp);
+    }
+    buf[strcspn(buf, "\n")] = '\0';
+    return buf;
+}
+
+// the kernel resets the request file on release, the fake tree has to be told
+static void release(const std::string& device)
+{
+    mkfile(root + "/sys/class/pwm/" + device + "/request", device + " is free\n");
+}
+
+static void makeTree()
+{
+    for(size_t i = 0; i < sizeof(pwm_devices) / sizeof(pwm_devices[0]); ++i)
+    {
+        const std::string dir = root + "/sys/class/pwm/" + pwm_devices[i] + "/";
+        mkdirs(dir);
+        release(pwm_devices[i]);
+        mkfile(dir + "duty_ns", "0\n");
+        mkfile(dir + "period_ns", "0\n");
+        mkfile(dir + "polarity", "0\n");
+        mkfile(dir + "run", "0\n");
+    }
+
+    mkdirs(root + "/sys/class/gpio");
+    mkfile(root + "/sys/class/gpio/export", "");
+    mkfile(root + "/sys/class/gpio/unexport", "");
+    for(int n = 0; n < 128; ++n)
+    {
+        std::stringstream dir;
+        dir << root << "/sys/class/gpio/gpio" << n << "/";
+        mkdirs(dir.str());
+        mkfile(dir.str() + "direction", "in\n");
+        mkfile(dir.str() + "value", "0\n");
+    }
+
+    mkdirs(root + "/sys/kernel/debug/omap_mux");
+
+    // up to the end of the PWMSS2 registers, sparse
+    mkfile(root + "/mem", "");
+    if(truncate((root + "/mem").c_str(), 0x48305000) != 0)
+        perror("truncate");
+}
+
+static int removeEntry(const char* path, const struct stat*, int, struct FTW*)
+{
+    return remove(path);
+}
+
+/** Timings of one operation, reported as throughput and p50/p99/max latency. */
+class Measurement
+{
+public:
+    explicit Measurement(const char* name) : _name(name), _start(0), _total(0) {}
+
+    void start() { _start = now_ns(); }
+    void stop()
+    {
+        const uint64_t ns = now_ns() - _start;
+        _samples.push_back(ns);
+        _total += ns;
+    }
+
+    void report()
+    {
+        if(_samples.empty())
+            return;
+        std::sort(_samples.begin(), _samples.end());
+        printf("%-28s %10.0f %10llu %10llu %10llu\n", _name,
+               _samples.size() * 1e9 / _total,
+               (unsigned long long)_samples[_samples.size() / 2],
+               (unsigned long long)_samples[_samples.size() * 99 / 100],
+               (unsigned long long)_samples.back());
+    }
+
+private:
+    const char* _name;
+    uint64_t _start;
+    uint64_t _total;
+    std::vector<uint64_t> _samples;
+};
+
+int main(int argc, char** argv)
+{
+    const int iterations = argc > 1 ? atoi(argv[1]) : 10000;
+    const long delayUs = argc > 2 ? atol(argv[2]) : 0;
+    bool failed = false;
+
+    char tmpl[] = "/tmp/bbservo-bench.XXXXXX";
+    if(mkdtemp(tmpl) == NULL)
+    {
+        perror("mkdtemp");
+        return 1;
+    }
+    root = tmpl;
+    makeTree();
+    SysfsAttr::setRoot(root);
+    SysfsAttr::setWriteDelayNs(delayUs * 1000);
+    const std::string mem = root + "/mem";
+    MemMap::setDevice(mem.c_str());
+    TraceRing::open((root + "/trace").c_str());
+
+    Measurement traceRecord("TraceRing::record");
+    Measurement servoAttach("Servo attach+detach");
+    Measurement servoWrite("Servo::write");
+    Measurement motorWrite("MotorPwm::write");
+    Measurement gpioSet("gpio::set");
+    Measurement gpioGet("gpio::get");
+    Measurement gpioMmapSet("gpio::set (mmap)");
+    Measurement gpioMmapGet("gpio::get (mmap)");
+    Measurement portWrite("gpio_port::write");
+    Measurement encoderPosition("Encoder::position");
+    Measurement encoderVelocity("Encoder::velocity");
+    Measurement driverInit("MotorDriver::init");
+    Measurement driverForward("MotorDriver::forward");
+    Measurement driverStop("MotorDriver::stop");
+    Measurement driverVelocity("MotorDriver::setVelocity");
+    Measurement driverOdometry("MotorDriver::updateOdometry");
+    Measurement odometryPose("Odometry::pose");
+
+    for(int i = 0; i < iterations; ++i)
+    {
+        traceRecord.start();
+        TraceRing::record(0, TraceRing::PWM_DUTY, i, 0, 0);
+        traceRecord.stop();
+    }
+
+    for(int i = 0; i < iterations / 10 + 1; ++i)
+    {
+        Servo servo;
+        release("ehrpwm.2:1");
+        servoAttach.start();
+        servo.attach("P8_13");
+        servo.detach();
+        servoAttach.stop();
+    }
+
+    {
+        Servo servo;
+        release("ehrpwm.2:1");
+        servo.attach("P8_13");
+        for(int i = 0; i < iterations; ++i)
+        {
+            servoWrite.start();
+            servo.write(i % 181);
+            servoWrite.stop();
+        }
+        servo.detach();
+    }
+
+    {
+        MotorPwm motor;
+        release("ehrpwm.2:0");
+        motor.attach("P8_19");
+        for(int i = 0; i < iterations; ++i)
+        {
+            motorWrite.start();
+            motor.write(i % 101);
+            motorWrite.stop();
+        }
+        motor.detach();
+    }
+
+    BeagleBone::gpio* pin = BeagleBone::gpio::P8(12);
+    if(pin && pin->configure(BeagleBone::pin::OUT))
+    {
+        for(int i = 0; i < iterations; ++i)
+        {
+            gpioSet.start();
+            pin->set(i & 1);
+            gpioSet.stop();
+
+            gpioGet.start();
+            pin->get();
+            gpioGet.stop();
+        }
+    }
+
+    pin = BeagleBone::gpio::P8(12, BeagleBone::gpio::MMAP);
+    BeagleBone::gpio_port* port = pin ? BeagleBone::gpio_port::of(pin) : NULL;
+    if(port)
+    {
+        const uint32_t mask = BeagleBone::gpio_port::mask(pin);
+        for(int i = 0; i < iterations; ++i)
+        {
+            gpioMmapSet.start();
+            pin->set(i & 1);
+            gpioMmapSet.stop();
+
+            gpioMmapGet.start();
+            pin->get();
+            gpioMmapGet.stop();
+
+            portWrite.start();
+            port->write(mask | 1u, i & 1 ? mask : 1u);
+            portWrite.stop();
+        }
+    }
+
+    {
+        // the fake registers never count, this is the cost of reading them
+        Encoder encoder;
+        if(encoder.open(Encoder::MMAP))
+            for(int i = 0; i < iterations; ++i)
+            {
+                encoderPosition.start();
+                encoder.position();
+                encoderPosition.stop();
+
+                encoderVelocity.start();
+                encoder.velocity();
+                encoderVelocity.stop();
+            }
+    }
+
+    {
+        MotorDriver driver;
+        release("ehrpwm.1:0");
+        release("ehrpwm.1:1");
+        driverInit.start();
+        driver.init();
+        driverInit.stop();
+        for(int i = 0; i < iterations; ++i)
+        {
+            driverForward.start();
+            driver.forward(0, i % 101);
+            driverForward.stop();
+
+            driverStop.start();
+            driver.stop();
+            driverStop.stop();
+        }
+
+        // a maneuver after stop() has to move the motors again
+        driver.forward(0, 50);
+        for(int m = 0; m < 2; ++m)
+        {
+            const std::string dir = root + "/sys/class/pwm/ehrpwm.1:" + (char)('0' + m) + "/";
+            if(readLine(dir + "run") != "1" || readLine(dir + "duty_ns") == "0")
+            {
+                fprintf(stderr, "ehrpwm.1:%d not running after stop() and forward()\n", m);
+                failed = true;
+            }
+        }
+        driver.stop();
+
+        // a 100 Hz planner mostly repeats or nudges its last command
+        driver.setGeometry(0.15, 0.03, 20);
+        for(int i = 0; i < iterations; ++i)
+        {
+            driverVelocity.start();
+            driver.setVelocity(0.2 + (i / 10) * 0.01, (i / 50 % 2) ? 1.0 : -1.0);
+            driverVelocity.stop();
+        }
+
+        for(int i = 0; i < iterations; ++i)
+        {
+            driverOdometry.start();
+            driver.updateOdometry();
+            driverOdometry.stop();
+
+            odometryPose.start();
+            driver.odometry().pose();
+            odometryPose.stop();
+        }
+    }
+
+    printf("%d iterations, write delay %ld us, fake tree in %s\n\n", iterations, delayUs, root.c_str());
+    printf("%-28s %10s %10s %10s %10s\n", "operation", "ops/s", "p50 ns", "p99 ns", "max ns");
+    traceRecord.report();
+    servoAttach.report();
+    servoWrite.report();
+    motorWrite.report();
+    gpioSet.report();
+    gpioGet.report();
+    gpioMmapSet.report();
+    gpioMmapGet.report();
+    portWrite.report();
+    encoderPosition.report();
+    encoderVelocity.report();
+    driverInit.report();
+    driverForward.report();
+    driverStop.report();
+    driverVelocity.report();
+    driverOdometry.report();
+    odometryPose.report();
+
+    // the compute pass alone, the feedback and outputs are the cases above
+    printf("\n%-28s %10s %10s\n", "PidEngine::update", "axes", "ns/axis");
+    const int axisCounts[] = {1, 4, 16, 64, 256};
+    for(size_t c = 0; c < sizeof(axisCounts) / sizeof(axisCounts[0]); ++c)
+    {
+        PidEngine engine;
+        for(int a = 0; a < axisCounts[c]; ++a)
+        {
+            engine.addAxis(NULL, NULL);
+            engine.setGains(a, 2.0f, 0.5f, 0.01f, 0.1f);
+            engine.setDerivativeFilter(a, 0.02f);
+            engine.setLimits(a, -MAX_SPEED, MAX_SPEED, MIN_SPEED);
+        }
+        // setSetpoint() only reaches update() through step(), fill both sides
+        // directly so every axis has an error to act on
+        float* setpoints = engine.setpoints();
+        float* measurement = engine.measurement();
+        for(int a = 0; a < axisCounts[c]; ++a)
+        {
+            setpoints[a] = (a % 7) * 10.0f - 30.0f;
+            measurement[a] = setpoints[a] - 1.5f - (a % 3);
+        }
+        engine.reset();     // no derivative kick from the jump to these measurements
+        const uint64_t start = now_ns();
+        for(int i = 0; i < iterations; ++i)
+            engine.update();
+        const uint64_t ns = now_ns() - start;
+        printf("%-28s %10d %10.2f\n", "", axisCounts[c], (double)ns / iterations / axisCounts[c]);
+    }
+
+    TraceRing::close();
+    nftw(root.c_str(), removeEntry, 16, FTW_DEPTH | FTW_PHYS);
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,193 @@
+//
+// Copyright (c) 2012 Janick Bergeron
+// All Rights Reserved
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//
+
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "board.hpp"
+
+namespace BeagleBone {
+
+int
+board::configure(const pin_config* cfg, int n, pin_change* report)
+{
+  pin_change* changes = report;
+  if (changes == NULL) changes = (pin_change*) malloc(n * sizeof(pin_change));
+  FILE** files = (FILE**) calloc(n, sizeof(FILE*));
+  int ok = 1;
+
+  //
+  // Check the whole description before touching any pin
+  //
+  for (int i = 0; i < n; i++) {
+    const pin_config& c = cfg[i];
+    pin_change& r = changes[i];
+    r.p        = c.p;
+    r.from     = (c.p == NULL) ? NULL : c.p->get_fct();
+    r.to       = c.fct;
+    r.old_code = -1;
+    r.new_code = -1;
+    r.status   = pin_change::FAILED;
+
+    if (c.p == NULL || c.fct == NULL) {
+      fprintf(stderr, "ERROR: Board description line %d has no pin or no function.\n", i);
+      ok = 0;
+      continue;
+    }
+
+    int mode = c.p->m_mode_of(c.fct);
+    if (mode < 0) {
+      fprintf(stderr, "ERROR: Pin %s cannot export %s function.\n",
+	      c.p->get_name(), c.fct->get_name());
+      ok = 0;
+      continue;
+    }
+
+    // Non-muxed pins (power, ground...) have nothing to write and may share
+    // their function with other pins
+    if (*c.p->m_dev == '\0') {
+      r.status = pin_change::UNCHANGED;
+      continue;
+    }
+
+    int dup = 0;
+    for (int j = 0; j < i; j++) {
+      if (cfg[j].p == c.p) {
+	fprintf(stderr, "ERROR: Pin %s is configured twice.\n", c.p->get_name());
+	dup = 1;
+      }
+      else if (cfg[j].fct == c.fct) {
+	fprintf(stderr, "ERROR: %s function is requested on both pins %s and %s.\n",
+		c.fct->get_name(), cfg[j].p->get_name(), c.p->get_name());
+	dup = 1;
+      }
+    }
+    if (dup) {
+      ok = 0;
+      continue;
+    }
+
+    // Carried by another pin that this description does not remux?
+    pin* other = c.fct->get_pin();
+    if (other != NULL && other != c.p) {
+      int moved = 0;
+      for (int j = 0; j < n; j++) {
+	if (cfg[j].p == other && cfg[j].fct != c.fct) moved = 1;
+      }
+      if (!moved) {
+	fprintf(stderr, "ERROR: %s function is currently exported by pin %s.\n",
+		c.fct->get_name(), other->get_name());
+	ok = 0;
+	continue;
+      }
+    }
+
+    r.new_code = pin::m_mux_code(mode, c.dir, c.pulls);
+    r.old_code = c.p->m_read_code();
+    if (r.old_code == r.new_code) {
+      r.status = pin_change::UNCHANGED;
+      continue;
+    }
+
+    if (c.p->is_locked()) {
+      fprintf(stderr, "ERROR: Pin %s is locked exporting %s function.\n",
+	      c.p->get_name(), c.fct->get_name());
+      ok = 0;
+      continue;
+    }
+
+    r.status = pin_change::CHANGED;
+  }
+
+  //
+  // Open every mux file to change, so a missing one aborts before any write
+  //
+  for (int i = 0; ok && i < n; i++) {
+    if (changes[i].status != pin_change::CHANGED) continue;
+
+    char path[256];
+    cfg[i].p->m_path(path, sizeof(path));
+    files[i] = fopen(path, "w");
+    if (files[i] == NULL) {
+      fprintf(stderr, "ERROR: Cannot open %s for writing: ", path);
+      perror(0);
+      ok = 0;
+    }
+  }
+
+  //
+  // Apply, or back out without writing anything
+  //
+  for (int i = 0; i < n; i++) {
+    pin_change& r = changes[i];
+
+    if (!ok) {
+      if (files[i] != NULL) fclose(files[i]);
+      if (r.status == pin_change::CHANGED) r.status = pin_change::FAILED;
+      continue;
+    }
+
+    if (r.status == pin_change::CHANGED) {
+      fprintf(files[i], "%x\n", r.new_code);
+      if (fclose(files[i]) != 0) {
+	fprintf(stderr, "ERROR: Cannot mux pin %s to %s function: ",
+		cfg[i].p->get_name(), cfg[i].fct->get_name());
+	perror(0);
+	r.status = pin_change::FAILED;
+	continue;
+      }
+    }
+
+    cfg[i].p->m_fct = cfg[i].fct;
+    if (r.new_code >= 0) cfg[i].p->m_code = r.new_code;
+  }
+
+  // Writes that failed after the checks passed
+  for (int i = 0; ok && i < n; i++) {
+    if (changes[i].status == pin_change::FAILED) ok = 0;
+  }
+
+  free(files);
+  if (report == NULL) free(changes);
+
+  return ok;
+}
+
+
+void
+board::print_report(FILE* fp, const pin_change* report, int n)
+{
+  static const char* const status[] = {"unchanged", "changed", "FAILED"};
+
+  for (int i = 0; i < n; i++) {
+    const pin_change& r = report[i];
+    fprintf(fp, "%-6s %-20s -> %-20s ",
+	    (r.p    == NULL) ? "?" : r.p->get_name(),
+	    (r.from == NULL) ? "?" : r.from->get_name(),
+	    (r.to   == NULL) ? "?" : r.to->get_name());
+    if (r.old_code < 0) fprintf(fp, "  ?? -> ");
+    else fprintf(fp, "0x%02x -> ", r.old_code);
+    if (r.new_code < 0) fprintf(fp, "  ??  ");
+    else fprintf(fp, "0x%02x  ", r.new_code);
+    fprintf(fp, "%s\n", status[r.status]);
+  }
+}
+
+}
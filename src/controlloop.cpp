@@ -0,0 +1,205 @@
+#include "controlloop.h"
+#include <iostream>
+#include <errno.h>
+#include <sched.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+
+#define NSEC_PER_SEC 1000000000LL
+
+static inline int64_t diff_ns(const struct timespec& a, const struct timespec& b)
+{
+    return (int64_t)(a.tv_sec - b.tv_sec) * NSEC_PER_SEC + (a.tv_nsec - b.tv_nsec);
+}
+
+static inline void add_ns(struct timespec& t, int64_t ns)
+{
+    const int64_t nsec = t.tv_nsec + ns;
+    t.tv_sec += nsec / NSEC_PER_SEC;
+    t.tv_nsec = nsec % NSEC_PER_SEC;
+}
+
+ControlLoop::ControlLoop(int64_t periodNs)
+    : _periodNs(periodNs), _priority(0), _cpu(-1), _lockMemory(false), _running(false),
+      _resetPending(false)
+{
+    clearStats();
+}
+
+ControlLoop::~ControlLoop()
+{
+    stop();
+}
+
+bool ControlLoop::add(callback_t callback, void* arg)
+{
+    if(_running)
+    {
+        std::cerr << "ControlLoop: cannot add a callback to a running loop" << std::endl;
+        return false;
+    }
+
+    Callback cb;
+    cb.callback = callback;
+    cb.arg = arg;
+    _callbacks.push_back(cb);
+    return true;
+}
+
+void ControlLoop::setPriority(int priority)
+{
+    _priority = priority;
+}
+
+void ControlLoop::setCpu(int cpu)
+{
+    _cpu = cpu;
+}
+
+void ControlLoop::setLockMemory(bool lock)
+{
+    _lockMemory = lock;
+}
+
+bool ControlLoop::start()
+{
+    if(_running)
+        return true;
+
+    if(_lockMemory && mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
+        std::cerr << "ControlLoop: cannot lock memory: " << strerror(errno) << std::endl;
+
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    if(_priority > 0)
+    {
+        struct sched_param param;
+        memset(&param, 0, sizeof(param));
+        param.sched_priority = _priority;
+        pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+        pthread_attr_setschedpolicy(&attr, SCHED_FIFO);
+        pthread_attr_setschedparam(&attr, &param);
+    }
+    if(_cpu >= 0)
+    {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET(_cpu, &cpus);
+        pthread_attr_setaffinity_np(&attr, sizeof(cpus), &cpus);
+    }
+
+    _running = true;
+    int err = pthread_create(&_thread, &attr, &ControlLoop::run, this);
+    if(err == EPERM && _priority > 0)
+    {
+        // not allowed to run real-time, keep the deadlines at least
+        std::cerr << "ControlLoop: no permission for SCHED_FIFO, using the normal scheduler" << std::endl;
+        pthread_attr_setinheritsched(&attr, PTHREAD_INHERIT_SCHED);
+        err = pthread_create(&_thread, &attr, &ControlLoop::run, this);
+    }
+    pthread_attr_destroy(&attr);
+
+    if(err)
+    {
+        std::cerr << "ControlLoop: cannot start thread: " << strerror(err) << std::endl;
+        _running = false;
+        return false;
+    }
+    return true;
+}
+
+void ControlLoop::stop()
+{
+    if(!_running)
+        return;
+
+    _running = false;
+    pthread_join(_thread, NULL);
+}
+
+bool ControlLoop::running() const
+{
+    return _running;
+}
+
+int64_t ControlLoop::periodNs() const
+{
+    return _periodNs;
+}
+
+ControlLoop::Stats ControlLoop::stats() const
+{
+    Stats s = {0, 0, 0, 0, 0};
+    if(_resetPending)
+        return s;
+    s.cycles = _cycles;
+    s.overruns = _overruns;
+    s.maxJitterNs = _maxJitterNs;
+    s.meanJitterNs = s.cycles ? _sumJitterNs / (int64_t)s.cycles : 0;
+    s.maxCycleNs = _maxCycleNs;
+    return s;
+}
+
+void ControlLoop::resetStats()
+{
+    _resetPending = true;
+}
+
+void ControlLoop::clearStats()
+{
+    _cycles = 0;
+    _overruns = 0;
+    _maxJitterNs = 0;
+    _sumJitterNs = 0;
+    _maxCycleNs = 0;
+}
+
+void* ControlLoop::run(void* self)
+{
+    static_cast<ControlLoop*>(self)->loop();
+    return NULL;
+}
+
+void ControlLoop::loop()
+{
+    struct timespec deadline, now;
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    add_ns(deadline, _periodNs);
+
+    const size_t n = _callbacks.size();
+    while(_running)
+    {
+        while(clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR)
+            ;
+
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        const int64_t jitter = diff_ns(now, deadline);
+
+        for(size_t i = 0; i < n; ++i)
+            _callbacks[i].callback(_callbacks[i].arg);
+
+        struct timespec end;
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        const int64_t cycle = diff_ns(end, now);
+
+        // only this thread writes the statistics, plain load/store is enough
+        if(_resetPending.exchange(false))
+            clearStats();
+        _cycles.store(_cycles.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        _sumJitterNs.store(_sumJitterNs.load(std::memory_order_relaxed) + jitter, std::memory_order_relaxed);
+        if(jitter > _maxJitterNs.load(std::memory_order_relaxed))
+            _maxJitterNs.store(jitter, std::memory_order_relaxed);
+        if(cycle > _maxCycleNs.load(std::memory_order_relaxed))
+            _maxCycleNs.store(cycle, std::memory_order_relaxed);
+
+        add_ns(deadline, _periodNs);
+        if(diff_ns(end, deadline) > 0)
+        {
+            // overran the next deadline: skip the missed ones, keep the phase
+            _overruns.fetch_add(1, std::memory_order_relaxed);
+            const int64_t missed = diff_ns(end, deadline) / _periodNs + 1;
+            add_ns(deadline, missed * _periodNs);
+        }
+    }
+}
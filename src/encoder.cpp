@@ -0,0 +1,254 @@
+#include "encoder.h"
+#include <iostream>
+#include <glob.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "pinmux.hpp"
+#include "pins.h"
+
+#define EQEP_SIZE 0x60
+#define EQEP_SYSCLK_HZ 100000000u
+
+// eQEP registers
+#define QPOSCNT  0x00   // 32 bit
+#define QPOSINIT 0x04
+#define QPOSMAX  0x08
+#define QPOSLAT  0x18
+#define QUTMR    0x1C
+#define QUPRD    0x20
+#define QDECCTL  0x28   // 16 bit from here
+#define QEPCTL   0x2A
+#define QCAPCTL  0x2C
+#define QFLG     0x32
+#define QCLR     0x34
+#define QEPSTS   0x38
+#define QCPRDLAT 0x40
+
+// free run under emulation, reset on QPOSMAX, count, latch on unit timeout, unit timer
+#define QEPCTL_FREE     0x8000
+#define QEPCTL_PCRM_MAX 0x1000
+#define QEPCTL_PHEN     0x0008
+#define QEPCTL_QCLM     0x0004
+#define QEPCTL_UTE      0x0002
+#define QEPCTL_SWI      0x0080
+
+// capture clock SYSCLK/128, capture every 4 counts (one line)
+#define QCAPCTL_CEN 0x8000
+#define CCPS 7
+#define UPPS 2
+
+#define QFLG_UTO    0x0800
+#define QEPSTS_QDF  0x0020   // counting up
+#define QEPSTS_COEF 0x0008   // capture timer overflowed: too slow to measure
+#define QEPSTS_CDEF 0x0004   // direction changed between captures
+
+// below this many counts per unit period the capture timer is more precise
+#define LOW_SPEED_COUNTS 16
+
+// Where does the sysfs eqep driver live? (relative to SysfsAttr::root())
+static const char* const sysfs_dirs[] = {"/sys/devices/ocp.*/48304000.epwmss/48304180.eqep",
+                                         "/sys/devices/platform/ocp/48304000.epwmss/48304180.eqep"};
+
+static uint64_t now_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+Encoder::Encoder()
+    : _backend(MMAP), _open(false), _unitPeriodNs(10000000), _velocity(0), _latched(0),
+      _latchedNs(0), _sampleNs(0), _sample(0)
+{
+}
+
+Encoder::~Encoder()
+{
+    close();
+}
+
+bool Encoder::open(backend_t backend, long unitPeriodNs)
+{
+    close();
+    _unitPeriodNs = unitPeriodNs;
+    _velocity = 0;
+    if(!mux())
+        return false;
+
+    if(backend == MMAP && openRegisters())
+        _backend = MMAP;
+    else if(openSysfs())
+        _backend = SYSFS;
+    else
+        return false;
+
+    _open = true;
+    return true;
+}
+
+void Encoder::close()
+{
+    _regs.unmap();
+    _position.close();
+    _open = false;
+}
+
+bool Encoder::isOpen() const
+{
+    return _open;
+}
+
+Encoder::backend_t Encoder::backend() const
+{
+    return _backend;
+}
+
+bool Encoder::mux()
+{
+    using BeagleBone::pin_fct;
+
+    // the A/B pairs have differently spelled functions in the pin table
+    if(pin_fct::eqep2a_in->xport(BeagleBone::pin::IN, BeagleBone::pin::PU)
+       && pin_fct::eqep2B_in->xport(BeagleBone::pin::IN, BeagleBone::pin::PU))
+        return true;
+    if(pin_fct::eQEP2A_in->xport(BeagleBone::pin::IN, BeagleBone::pin::PU)
+       && pin_fct::eqep2b_in->xport(BeagleBone::pin::IN, BeagleBone::pin::PU))
+        return true;
+
+    std::cerr << "Encoder: cannot mux the eQEP2 inputs" << std::endl;
+    return false;
+}
+
+bool Encoder::openRegisters()
+{
+    if(!_regs.map(Pins::PWMSS_BASE[2] + Pins::EQEP_OFFSET, EQEP_SIZE))
+        return false;
+
+    *_regs.reg16(QEPCTL) = 0;
+    *_regs.reg16(QDECCTL) = 0;                       // quadrature count mode
+    *_regs.reg32(QPOSINIT) = 0;
+    *_regs.reg32(QPOSMAX) = 0xffffffff;
+    *_regs.reg32(QPOSCNT) = 0;
+    *_regs.reg32(QUPRD) = (uint32_t)((uint64_t)_unitPeriodNs * (EQEP_SYSCLK_HZ / 1000) / 1000000);
+    *_regs.reg16(QCAPCTL) = 0;                       // prescalers only change with capture off
+    *_regs.reg16(QCAPCTL) = (CCPS << 4) | UPPS;
+    *_regs.reg16(QCAPCTL) = QCAPCTL_CEN | (CCPS << 4) | UPPS;
+    *_regs.reg16(QCLR) = 0xffff;
+    *_regs.reg16(QEPCTL) = QEPCTL_FREE | QEPCTL_PCRM_MAX | QEPCTL_PHEN | QEPCTL_QCLM | QEPCTL_UTE;
+    _latched = 0;
+    _latchedNs = now_ns();
+    return true;
+}
+
+bool Encoder::openSysfs()
+{
+    glob_t found;
+    std::string dir;
+    for(size_t i = 0; i < sizeof(sysfs_dirs) / sizeof(sysfs_dirs[0]) && dir.empty(); ++i)
+    {
+        if(glob((SysfsAttr::root() + sysfs_dirs[i]).c_str(), 0, NULL, &found) == 0)
+            dir = found.gl_pathv[0];
+        globfree(&found);
+    }
+    if(dir.empty() || !_position.open(dir + "/position"))
+    {
+        std::cerr << "Encoder: no eqep driver in sysfs" << std::endl;
+        return false;
+    }
+
+    // the driver's own settings, older versions lack them
+    SysfsAttr attr;
+    if(attr.open(dir + "/period"))
+        attr.write((int)_unitPeriodNs);
+    if(attr.open(dir + "/enabled"))
+        attr.write(1);
+
+    _position.write(0);
+    _sample = 0;
+    _sampleNs = now_ns();
+    return true;
+}
+
+int32_t Encoder::position()
+{
+    if(_backend == MMAP)
+        return (int32_t)*_regs.reg32(QPOSCNT);
+
+    std::string value;
+    if(!_position.read(value))
+        return 0;
+    return atoi(value.c_str());
+}
+
+void Encoder::setPosition(int32_t pos)
+{
+    if(_backend == MMAP)
+    {
+        // QPOSINIT is loaded on a software init event
+        *_regs.reg32(QPOSINIT) = pos;
+        *_regs.reg16(QEPCTL) |= QEPCTL_SWI;
+        *_regs.reg16(QEPCTL) &= ~QEPCTL_SWI;
+        *_regs.reg32(QPOSINIT) = 0;
+        return;
+    }
+    _position.write(pos);
+}
+
+double Encoder::velocity()
+{
+    if(_backend == SYSFS)
+    {
+        const uint64_t now = now_ns();
+        if(now - _sampleNs >= (uint64_t)_unitPeriodNs)
+        {
+            const int32_t pos = position();
+            _velocity = (pos - _sample) * 1e9 / (now - _sampleNs);
+            _sample = pos;
+            _sampleNs = now;
+        }
+        return _velocity;
+    }
+
+    // nothing new until the next unit timeout
+    if(!(*_regs.reg16(QFLG) & QFLG_UTO))
+        return _velocity;
+
+    const uint64_t now = now_ns();
+    const uint32_t sinceLatch = *_regs.reg32(QUTMR);
+    const uint32_t latched = *_regs.reg32(QPOSLAT);
+    const uint16_t status = *_regs.reg16(QEPSTS);
+    const uint16_t period = *_regs.reg16(QCPRDLAT);
+    *_regs.reg16(QCLR) = QFLG_UTO;
+    *_regs.reg16(QEPSTS) = QEPSTS_COEF | QEPSTS_CDEF;
+
+    // QPOSLAT only holds the last latch: when called less than once per unit
+    // period the difference spans several of them. Latches are exactly one
+    // unit period apart, so rounding the time between them counts them.
+    const uint64_t latchedNs = now - (uint64_t)sinceLatch * (1000000000u / EQEP_SYSCLK_HZ);
+    int64_t units = ((int64_t)(latchedNs - _latchedNs) + _unitPeriodNs / 2) / _unitPeriodNs;
+    if(units < 1)
+        units = 1;
+    const int32_t counts = (int32_t)(latched - _latched);
+    const double unitNs = (double)_unitPeriodNs * units;
+    _latched = latched;
+    _latchedNs = latchedNs;
+
+    if(counts / units > -LOW_SPEED_COUNTS && counts / units < LOW_SPEED_COUNTS)
+    {
+        if(status & QEPSTS_COEF)
+            _velocity = 0;                           // slower than the capture timer can measure
+        else if(!(status & QEPSTS_CDEF) && period != 0)
+        {
+            const double v = (double)(1 << UPPS) * (EQEP_SYSCLK_HZ >> CCPS) / period;
+            _velocity = (status & QEPSTS_QDF) ? v : -v;
+        }
+        else
+            _velocity = counts * 1e9 / unitNs;
+    }
+    else
+    {
+        _velocity = counts * 1e9 / unitNs;
+    }
+    return _velocity;
+}
@@ -0,0 +1,231 @@
+#include "eventreactor.h"
+#include <iostream>
+#include <errno.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <time.h>
+#include <unistd.h>
+
+#define NSEC_PER_SEC 1000000000L
+
+// epoll data of the wake-up eventfd, sources are indexed from 0
+#define WAKE_INDEX 0xffffffffu
+
+static inline uint64_t now_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * NSEC_PER_SEC + ts.tv_nsec;
+}
+
+static inline struct timespec to_timespec(int64_t ns)
+{
+    struct timespec ts;
+    ts.tv_sec = ns / NSEC_PER_SEC;
+    ts.tv_nsec = ns % NSEC_PER_SEC;
+    return ts;
+}
+
+EventReactor::EventReactor()
+    : _epoll(epoll_create1(EPOLL_CLOEXEC)), _wake(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)),
+      _running(false), _events(0)
+{
+    if(_epoll < 0 || _wake < 0)
+        std::cerr << "EventReactor: cannot create epoll set: " << strerror(errno) << std::endl;
+    else
+        watch(_wake, EPOLLIN, WAKE_INDEX);
+}
+
+EventReactor::~EventReactor()
+{
+    stop();
+    for(size_t i = 0; i < _sources.size(); ++i)
+        if(_sources[i].pin == NULL)
+            close(_sources[i].fd);
+    if(_wake >= 0)
+        close(_wake);
+    if(_epoll >= 0)
+        close(_epoll);
+}
+
+bool EventReactor::watch(int fd, uint32_t events, uint32_t index)
+{
+    struct epoll_event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.events = events;
+    ev.data.u32 = index;
+    if(epoll_ctl(_epoll, EPOLL_CTL_ADD, fd, &ev) != 0)
+    {
+        std::cerr << "EventReactor: cannot watch descriptor " << fd << ": " << strerror(errno) << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool EventReactor::addEdge(BeagleBone::gpio* pin, BeagleBone::gpio::edge_t edge, edge_callback_t callback, void* arg)
+{
+    if(_running)
+    {
+        std::cerr << "EventReactor: cannot add a pin to a running reactor" << std::endl;
+        return false;
+    }
+
+    int fd = pin->get_fd();
+    if(fd < 0 || !pin->set_edge(edge))
+        return false;
+
+    // sysfs reports the file ready until it has been read once
+    char c;
+    pread(fd, &c, 1, 0);
+
+    Source src;
+    src.fd = fd;
+    src.pin = pin;
+    src.onEdge = callback;
+    src.onTimer = NULL;
+    src.arg = arg;
+    if(!watch(fd, EPOLLPRI | EPOLLERR, _sources.size()))
+        return false;
+    _sources.push_back(src);
+    return true;
+}
+
+int EventReactor::addTimer(timer_callback_t callback, void* arg)
+{
+    if(_running)
+    {
+        std::cerr << "EventReactor: cannot add a timer to a running reactor" << std::endl;
+        return -1;
+    }
+
+    int fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if(fd < 0)
+    {
+        std::cerr << "EventReactor: cannot create timer: " << strerror(errno) << std::endl;
+        return -1;
+    }
+
+    Source src;
+    src.fd = fd;
+    src.pin = NULL;
+    src.onEdge = NULL;
+    src.onTimer = callback;
+    src.arg = arg;
+    if(!watch(fd, EPOLLIN, _sources.size()))
+    {
+        close(fd);
+        return -1;
+    }
+    _sources.push_back(src);
+    return _sources.size() - 1;
+}
+
+bool EventReactor::armTimer(int id, int64_t delayNs, int64_t periodNs)
+{
+    if(id < 0 || id >= (int)_sources.size() || _sources[id].pin != NULL)
+    {
+        std::cerr << "EventReactor: no timer " << id << std::endl;
+        return false;
+    }
+
+    struct itimerspec spec;
+    spec.it_value = to_timespec(delayNs);
+    spec.it_interval = to_timespec(periodNs);
+    if(timerfd_settime(_sources[id].fd, 0, &spec, NULL) != 0)
+    {
+        std::cerr << "EventReactor: cannot arm timer " << id << ": " << strerror(errno) << std::endl;
+        return false;
+    }
+    return true;
+}
+
+int EventReactor::poll(int timeoutMs)
+{
+    struct epoll_event ready[MAX_EVENTS];
+    int n = epoll_wait(_epoll, ready, MAX_EVENTS, timeoutMs);
+    if(n < 0)
+        return errno == EINTR ? 0 : -1;
+
+    const uint64_t timestamp = now_ns();
+    int dispatched = 0;
+    for(int i = 0; i < n; ++i)
+    {
+        if(ready[i].data.u32 == WAKE_INDEX)
+        {
+            uint64_t count;
+            read(_wake, &count, sizeof(count));
+            continue;
+        }
+
+        const Source& src = _sources[ready[i].data.u32];
+        if(src.pin)
+        {
+            // reading the value also re-arms POLLPRI
+            char c = '0';
+            pread(src.fd, &c, 1, 0);
+            src.onEdge(src.pin, c == '1', timestamp, src.arg);
+        }
+        else
+        {
+            uint64_t expirations = 0;
+            if(read(src.fd, &expirations, sizeof(expirations)) != sizeof(expirations))
+                continue;            // disarmed in between
+            src.onTimer(expirations, timestamp, src.arg);
+        }
+        ++dispatched;
+    }
+
+    _events += dispatched;
+    return dispatched;
+}
+
+bool EventReactor::start()
+{
+    if(_running)
+        return true;
+
+    _running = true;
+    int err = pthread_create(&_thread, NULL, &EventReactor::run, this);
+    if(err)
+    {
+        std::cerr << "EventReactor: cannot start thread: " << strerror(err) << std::endl;
+        _running = false;
+        return false;
+    }
+    return true;
+}
+
+void EventReactor::stop()
+{
+    if(!_running)
+        return;
+
+    _running = false;
+    uint64_t one = 1;
+    write(_wake, &one, sizeof(one));
+    pthread_join(_thread, NULL);
+}
+
+bool EventReactor::running() const
+{
+    return _running;
+}
+
+unsigned long EventReactor::events() const
+{
+    return _events;
+}
+
+void* EventReactor::run(void* self)
+{
+    EventReactor* reactor = (EventReactor*)self;
+    while(reactor->_running)
+        if(reactor->poll(-1) < 0)
+        {
+            std::cerr << "EventReactor: wait failed: " << strerror(errno) << std::endl;
+            break;
+        }
+    return NULL;
+}
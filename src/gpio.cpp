@@ -18,48 +18,28 @@
 //
 
 #include <dirent.h>
+#include <fcntl.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <unistd.h>
 
 #include "gpio.hpp"
+#include "gpio_port.hpp"
+#include "sysfsattr.h"
 
 namespace BeagleBone {
 
 //
-// Where are the GPIO control devices?
+// Where are the GPIO control devices? (relative to SysfsAttr::root())
 //
 static const char* const devdir       = "/sys/class/gpio";
 static const char* const export_dev   = "/sys/class/gpio/export";
 static const char* const unexport_dev = "/sys/class/gpio/unexport";
 
 
-gpio::gpio(const char*    name,
-	   const char*    pin_dev,
-	   unsigned char  port_no,
-	   unsigned char  pin_no,
-	   pin_fct* const mode0,
-	   pin_fct* const mode1,
-	   pin_fct* const mode2,
-	   pin_fct* const mode3,
-	   pin_fct* const mode4,
-	   pin_fct* const mode5,
-	   pin_fct* const mode6,
-	   pin_fct* const mode7,
-	   int            init,
-	   direction_t    dir,
-	   pull_t         pulls)
-  : pin(name, pin_dev, mode0, mode1, mode2, mode3, mode4, mode5, mode6, mode7, init, dir, pulls),
-    m_number(port_no * 32 + pin_no)
-{
-  m_dev = (char*) malloc(strlen(devdir)+64);
-  sprintf(m_dev, "%s/gpio%d", devdir, m_number);
-  m_dev_append = m_dev + strlen(m_dev);
-}
-
-
 gpio*
-gpio::P8(unsigned char n)
+gpio::P8(unsigned char n, backend_t backend)
 {
   pin* p = pin::P8(n);
   gpio* gp;
@@ -72,14 +52,14 @@ gpio::P8(unsigned char n)
     return NULL;
   }
   
-  if (!gp->pin_xport()) return NULL;
+  if (!gp->pin_xport(backend)) return NULL;
 
   return gp;
 }
 
 
 gpio*
-gpio::P9(unsigned char n)
+gpio::P9(unsigned char n, backend_t backend)
 {
   pin* p = pin::P9(n);
   gpio* gp;
@@ -92,14 +72,14 @@ gpio::P9(unsigned char n)
     return NULL;
   }
   
-  if (!gp->pin_xport()) return NULL;
+  if (!gp->pin_xport(backend)) return NULL;
 
   return gp;
 }
 
 
 int
-gpio::pin_xport()
+gpio::pin_xport(backend_t backend)
 {
   // Already on GPIO function?
   if (get_fct() != get_gpio()) {
@@ -107,24 +87,47 @@ gpio::pin_xport()
     if (!xport(get_gpio())) return 0;
   }
 
+  // Pins are constructed statically, so only build the device path once
+  // it is used and the sysfs root is known.
+  const char* root = SysfsAttr::root().c_str();
+  if (m_dev == NULL) {
+    m_dev = (char*) malloc(strlen(root)+strlen(devdir)+64);
+    sprintf(m_dev, "%s%s/gpio%d", root, devdir, m_number);
+    m_dev_append = m_dev + strlen(m_dev);
+  }
+
   // Has the GPIO pin already been exported?
   *m_dev_append = '\0';
   DIR *dirp = opendir(m_dev);
   if (dirp != NULL) {
     closedir(dirp);
-    return 1;
+  }
+  else {
+    char path[256];
+    snprintf(path, sizeof(path), "%s%s", root, export_dev);
+    FILE *fp = fopen(path, "w");
+    if (fp == NULL) {
+      fprintf(stderr, "ERROR: Cannot export GPIO %s on pin %s: ", get_fct()->get_name(), get_name());
+      perror(0);
+      return 0;
+    }
+
+    fprintf(fp, "%d", m_number);
+
+    fclose(fp);
   }
 
-  FILE *fp = fopen(export_dev, "w");
-  if (fp == NULL) {
-    fprintf(stderr, "ERROR: Cannot export GPIO %s on pin %s: ", get_fct()->get_name(), get_name());
-    perror(0);
-    return 0;
+  // Keep the value file open for set() and get(). It may only show up (or
+  // become writable) a little after the export, so failing here is not an
+  // error: they retry.
+  if (m_value_fd < 0) {
+    strcpy(m_dev_append, "/value");
+    m_value_fd = open(m_dev, O_RDWR | O_CLOEXEC);
   }
 
-  fprintf(fp, "%d", m_number);
+  m_port = (backend == MMAP) ? gpio_port::of(this) : NULL;
 
-  fclose(fp);
+  if (m_trace == 0) m_trace = TraceRing::channel(get_name());
 
   return 1;
 }
@@ -133,56 +136,119 @@ gpio::pin_xport()
 int
 gpio::configure(pin::direction_t dir, pin::pull_t pulls)
 {
-  // Mux the pin in the right direction (redundent?)
-  pin::xport(get_gpio(), dir, pulls);
+  // Mux the pin in the right direction (redundent?), unless it already is
+  int mode = m_mode_of(get_gpio());
+  if (get_fct() != get_gpio() || m_read_code() != m_mux_code(mode, dir, pulls)) {
+    pin::xport(get_gpio(), dir, pulls);
+  }
+
+  // Next, configure the GPIO driver accordingly. Direction changes are
+  // rare, so that file is only opened when needed.
+  if (get_direction() == dir && m_direction >= 0) return 1;
 
-  // Next, configure the GPIO driver accordingly
   strcpy(m_dev_append, "/direction");
-  FILE* fp = fopen(m_dev, "w");
-  if (fp == NULL) {
+  int fd = open(m_dev, O_WRONLY | O_CLOEXEC);
+  if (fd < 0) {
     fprintf(stderr, "ERROR: Cannot configure GPIO %s on pin %s: ", get_fct()->get_name(), get_name());
     perror(0);
     return 0;
   }
 
-  if (dir == pin::IN) fprintf(fp, "in");
-  else fprintf(fp, "out");
-  
-  fclose(fp);
-  return 1;
+  const char* val = (dir == pin::IN) ? "in" : "out";
+  ssize_t len = strlen(val);
+  int ok = (write(fd, val, len) == len);
+  if (!ok) {
+    fprintf(stderr, "ERROR: Cannot configure GPIO %s on pin %s: ", get_fct()->get_name(), get_name());
+    perror(0);
+  }
+  else m_direction = dir;
+
+  close(fd);
+  return ok;
 }
 
 
 pin::direction_t
 gpio::get_direction()
 {
-  fprintf(stderr, "ERROR: gpio::get_direction() not yet implemented.\n");
-  return IN;
+  if (m_direction >= 0) return (pin::direction_t) m_direction;
+
+  // The driver reports "in" or "out" (or "high"/"low" where supported)
+  strcpy(m_dev_append, "/direction");
+  FILE* fp = fopen(m_dev, "r");
+  if (fp == NULL) {
+    fprintf(stderr, "ERROR: Cannot get direction of GPIO %s on pin %s: ", get_fct()->get_name(), get_name());
+    perror(0);
+    return IN;
+  }
+
+  char val[8] = "";
+  if (fgets(val, sizeof(val), fp) != NULL) {
+    m_direction = (strncmp(val, "in", 2) == 0) ? IN : OUT;
+  }
+  fclose(fp);
+
+  return (m_direction == OUT) ? OUT : IN;
 }
 
 
 pin::pull_t
 gpio::get_pulls()
 {
-  fprintf(stderr, "ERROR: gpio::get_pulls() not yet implemented.\n");
-  return NONE;
+  int code = m_read_code();
+  if (code < 0) {
+    fprintf(stderr, "ERROR: Cannot get pulls of GPIO %s on pin %s.\n", get_fct()->get_name(), get_name());
+    return NONE;
+  }
+
+  // See pin::m_mux_code() for the encoding
+  if (code & 0x08) return NONE;
+  if (code & 0x10) return PU;
+  return PD;
 }
 
 
 int
-gpio::set(unsigned char val)
+gpio::open_value(const char* what)
 {
+  if (m_value_fd >= 0) return 1;
+
   strcpy(m_dev_append, "/value");
-  FILE* fp = fopen(m_dev, "w");
-  if (fp == NULL) {
+  m_value_fd = open(m_dev, O_RDWR | O_CLOEXEC);
+  if (m_value_fd < 0) {
+    fprintf(stderr, "ERROR: Cannot %s GPIO %s on pin %s: ", what, get_fct()->get_name(), get_name());
+    perror(0);
+    return 0;
+  }
+
+  return 1;
+}
+
+
+int
+gpio::set(unsigned char val)
+{
+  uint64_t start = LatencyHistogram::now();
+
+  if (m_port != NULL) {
+    // The stores of gpio_port::set()/clear(), traced once, as this pin
+    if (val % 2) *m_port->m_set = gpio_port::mask(this);
+    else *m_port->m_clear = gpio_port::mask(this);
+    TraceRing::record(m_trace, TraceRing::GPIO_SET, val % 2, start, m_latency.record(start));
+    return 1;
+  }
+
+  // The value file stays open: a bit flip is a single pwrite()
+  if (m_value_fd < 0 && !open_value("set")) return 0;
+
+  if (pwrite(m_value_fd, (val % 2) ? "1" : "0", 1, 0) != 1) {
+    TraceRing::record(m_trace, TraceRing::GPIO_SET, val % 2, start, m_latency.record(start), false);
     fprintf(stderr, "ERROR: Cannot set GPIO %s on pin %s: ", get_fct()->get_name(), get_name());
     perror(0);
     return 0;
   }
 
-  fprintf(fp, "%d", val % 2);
-  
-  fclose(fp);
+  TraceRing::record(m_trace, TraceRing::GPIO_SET, val % 2, start, m_latency.record(start));
   return 1;
 }
 
@@ -190,20 +256,78 @@ gpio::set(unsigned char val)
 unsigned char
 gpio::get()
 {
-  strcpy(m_dev_append, "/value");
-  FILE* fp = fopen(m_dev, "r");
-  if (fp == NULL) {
+  uint64_t start = LatencyHistogram::now();
+
+  if (m_port != NULL) {
+    unsigned char v = (m_port->get() & gpio_port::mask(this)) != 0;
+    TraceRing::record(m_trace, TraceRing::GPIO_GET, v, start, m_latency.record(start));
+    return v;
+  }
+
+  if (m_value_fd < 0 && !open_value("get")) return 0;
+
+  char c;
+  if (pread(m_value_fd, &c, 1, 0) != 1) {
+    TraceRing::record(m_trace, TraceRing::GPIO_GET, 0, start, m_latency.record(start), false);
     fprintf(stderr, "ERROR: Cannot get GPIO %s on pin %s: ", get_fct()->get_name(), get_name());
     perror(0);
     return 0;
   }
 
-  char c = fgetc(fp);
-  fclose(fp);
+  TraceRing::record(m_trace, TraceRing::GPIO_GET, c == '1', start, m_latency.record(start));
 
   return c == '1';
 }
 
+
+int
+gpio::set_edge(edge_t edge)
+{
+  static const char* const names[] = {"none", "rising", "falling", "both"};
+
+  // Like the direction, only opened when needed
+  strcpy(m_dev_append, "/edge");
+  int fd = open(m_dev, O_WRONLY | O_CLOEXEC);
+  if (fd < 0) {
+    fprintf(stderr, "ERROR: Cannot set edge of GPIO %s on pin %s: ", get_fct()->get_name(), get_name());
+    perror(0);
+    return 0;
+  }
+
+  ssize_t len = strlen(names[edge]);
+  int ok = (write(fd, names[edge], len) == len);
+  if (!ok) {
+    fprintf(stderr, "ERROR: Cannot set edge of GPIO %s on pin %s: ", get_fct()->get_name(), get_name());
+    perror(0);
+  }
+
+  close(fd);
+  return ok;
+}
+
+
+int
+gpio::get_fd()
+{
+  if (m_value_fd < 0 && !open_value("wait on")) return -1;
+
+  return m_value_fd;
+}
+
+
+LatencyHistogram::Stats
+gpio::get_latency_stats() const
+{
+  return m_latency.stats();
+}
+
+
+void
+gpio::reset_latency_stats()
+{
+  m_latency.reset();
+}
+
 }
 
 #ifdef TEST
@@ -0,0 +1,119 @@
+//
+// Copyright (c) 2012 Janick Bergeron
+// All Rights Reserved
+//
+//   Licensed under the Apache License, Version 2.0 (the
+//   "License"); you may not use this file except in
+//   compliance with the License.  You may obtain a copy of
+//   the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in
+//   writing, software distributed under the License is
+//   distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+//   CONDITIONS OF ANY KIND, either express or implied.  See
+//   the License for the specific language governing
+//   permissions and limitations under the License.
+//
+
+
+#include <pthread.h>
+#include <stdio.h>
+
+#include "gpio.hpp"
+#include "gpio_port.hpp"
+
+namespace BeagleBone {
+
+//
+// GPIO bank registers
+//
+static const uint32_t bank_base[4] = {0x44E07000, 0x4804C000, 0x481AC000, 0x481AE000};
+
+#define GPIO_OE           0x134
+#define GPIO_DATAIN       0x138
+#define GPIO_DATAOUT      0x13C
+#define GPIO_CLEARDATAOUT 0x190
+#define GPIO_SETDATAOUT   0x194
+#define GPIO_SIZE         0x198
+
+// Mapped on first use, never unmapped. Pins may be configured from
+// several threads, so the first use is serialized.
+static gpio_port* banks[4] = {NULL, NULL, NULL, NULL};
+static pthread_mutex_t banks_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+
+gpio_port::gpio_port()
+  : m_oe(NULL), m_datain(NULL), m_dataout(NULL), m_clear(NULL), m_set(NULL), m_trace(0)
+{
+}
+
+
+int
+gpio_port::map(unsigned char n)
+{
+  if (!m_regs.map(bank_base[n], GPIO_SIZE)) return 0;
+
+  m_oe      = m_regs.reg32(GPIO_OE);
+  m_datain  = m_regs.reg32(GPIO_DATAIN);
+  m_dataout = m_regs.reg32(GPIO_DATAOUT);
+  m_clear   = m_regs.reg32(GPIO_CLEARDATAOUT);
+  m_set     = m_regs.reg32(GPIO_SETDATAOUT);
+
+  char name[8];
+  snprintf(name, sizeof(name), "gpio%d", n);
+  m_trace = TraceRing::channel(name);
+
+  return 1;
+}
+
+
+gpio_port*
+gpio_port::bank(unsigned char n)
+{
+  if (n >= 4) {
+    fprintf(stderr, "ERROR: GPIO bank %d does not exist.\n", n);
+    return NULL;
+  }
+
+  pthread_mutex_lock(&banks_mutex);
+  if (banks[n] == NULL) {
+    gpio_port* port = new gpio_port();
+    if (port->map(n)) {
+      banks[n] = port;
+    } else {
+      fprintf(stderr, "ERROR: Cannot map GPIO bank %d.\n", n);
+      delete port;
+    }
+  }
+  gpio_port* port = banks[n];
+  pthread_mutex_unlock(&banks_mutex);
+
+  return port;
+}
+
+
+gpio_port*
+gpio_port::of(const gpio* pin)
+{
+  return bank(pin->m_number / 32);
+}
+
+
+uint32_t
+gpio_port::mask(const gpio* pin)
+{
+  return 1u << (pin->m_number % 32);
+}
+
+
+void
+gpio_port::set_output(uint32_t mask, int enable)
+{
+  // OE is active low: a 0 bit enables the output driver
+  if (enable) *m_oe &= ~mask;
+  else *m_oe |= mask;
+}
+
+}
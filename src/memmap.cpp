@@ -0,0 +1,84 @@
+#include "memmap.h"
+#include <iostream>
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+const char* MemMap::_device = "/dev/mem";
+
+MemMap::MemMap()
+    : _map(MAP_FAILED), _mapLen(0), _base(NULL)
+{
+}
+
+MemMap::~MemMap()
+{
+    unmap();
+}
+
+bool MemMap::map(uint32_t phys, size_t len)
+{
+    unmap();
+
+    const uint32_t page = sysconf(_SC_PAGESIZE);
+    const uint32_t start = phys & ~(page - 1);
+    const size_t mapLen = len + (phys - start);
+
+    int fd = open(_device, O_RDWR | O_SYNC | O_CLOEXEC);
+    if(fd < 0)
+    {
+        std::cerr << "Cannot open " << _device << ": " << strerror(errno) << std::endl;
+        return false;
+    }
+
+    // a stand-in file must cover the range, touching past its end would SIGBUS
+    struct stat st;
+    if(fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && (off_t)(start + mapLen) > st.st_size)
+    {
+        std::cerr << _device << " is too small to map 0x" << std::hex << phys << std::dec << std::endl;
+        ::close(fd);
+        return false;
+    }
+
+    _map = mmap(NULL, mapLen, PROT_READ | PROT_WRITE, MAP_SHARED, fd, start);
+    ::close(fd);
+    if(_map == MAP_FAILED)
+    {
+        std::cerr << "Cannot map 0x" << std::hex << phys << std::dec << " of " << _device
+                  << ": " << strerror(errno) << std::endl;
+        return false;
+    }
+
+    _mapLen = mapLen;
+    _base = (volatile uint8_t*)_map + (phys - start);
+    return true;
+}
+
+void MemMap::unmap()
+{
+    if(_map != MAP_FAILED)
+    {
+        munmap(_map, _mapLen);
+        _map = MAP_FAILED;
+        _mapLen = 0;
+        _base = NULL;
+    }
+}
+
+bool MemMap::isMapped() const
+{
+    return _base != NULL;
+}
+
+void MemMap::setDevice(const char* path)
+{
+    _device = path;
+}
+
+const char* MemMap::device()
+{
+    return _device;
+}
@@ -0,0 +1,150 @@
+#include "mmappwm.h"
+#include <iostream>
+#include <stdio.h>
+
+#include "pins.h"
+
+#define EHRPWM_SIZE   0x60
+
+// EHRPWM registers (16 bit)
+#define TBCTL   0x00
+#define TBPRD   0x0A
+#define CMPCTL  0x0E
+#define CMPA    0x12
+#define CMPB    0x14
+#define AQCTLA  0x16
+#define AQCTLB  0x18
+#define AQCSFRC 0x1C
+
+#define TBCTL_CTRMODE_MASK 0x0003
+#define TBCTL_CTRMODE_UP   0x0000
+#define TBCTL_HSPCLKDIV_SHIFT 7
+#define TBCTL_CLKDIV_SHIFT    10
+#define TBCTL_DIV_MASK     (0x3f << TBCTL_HSPCLKDIV_SHIFT)
+
+// action qualifier: set on zero, clear on compare (inverted swaps the two)
+#define AQ_ZRO_SET   0x0002
+#define AQ_ZRO_CLEAR 0x0001
+#define AQ_CAU_SET   0x0020
+#define AQ_CAU_CLEAR 0x0010
+#define AQ_CBU_SET   0x0200
+#define AQ_CBU_CLEAR 0x0100
+
+#define EHRPWM_TBCLK_HZ 100000000u
+#define EHRPWM_MAX_COUNTS 65536u
+
+MmapPwm::MmapPwm()
+    : _output(0), _cmp(NULL), _countsPerNs(0), _polarity(0)
+{
+}
+
+bool MmapPwm::open(const std::string& device)
+{
+    int module, output;
+    if(sscanf(device.c_str(), "ehrpwm.%d:%d", &module, &output) != 2
+       || module < 0 || module > 2 || output < 0 || output > 1)
+    {
+        std::cerr << "PWM device " << device << " has no EHRPWM registers" << std::endl;
+        return false;
+    }
+
+    if(!_regs.map(Pins::PWMSS_BASE[module] + Pins::EHRPWM_OFFSET, EHRPWM_SIZE))
+        return false;
+
+    _device = device;
+    _output = output;
+    _cmp = _regs.reg16(output ? CMPB : CMPA);
+    return true;
+}
+
+void MmapPwm::close()
+{
+    _regs.unmap();
+    _cmp = NULL;
+}
+
+std::string MmapPwm::requestStatus() const
+{
+    return _device + " is free (registers mapped)";
+}
+
+bool MmapPwm::set_request(int val)
+{
+    // nothing claims the registers, a release leaves the output low at duty 0
+    if(!val)
+    {
+        *_cmp = 0;
+        return set_run(0);
+    }
+
+    // shadowed compare registers, loaded at counter zero: no glitches on update
+    *_regs.reg16(CMPCTL) = 0;
+    set_polarity(_polarity);
+    return set_run(0);
+}
+
+bool MmapPwm::set_duty(int val)
+{
+    if(!_countsPerNs)
+    {
+        std::cerr << "PWM duty set before the period for " << _device << std::endl;
+        return false;
+    }
+
+    // above TBPRD the compare never matches: the output stays on, 100% duty
+    const uint32_t tbprd = *_regs.reg16(TBPRD);
+    const uint64_t max = tbprd < 0xFFFF ? tbprd + 1 : 0xFFFF;  // CMP is 16 bits
+    const uint64_t counts = val > 0 ? ((uint64_t)val * _countsPerNs) >> 32 : 0;
+    *_cmp = counts < max ? counts : max;
+    return true;
+}
+
+bool MmapPwm::set_period(int val)
+{
+    // smallest prescaler (CLKDIV 2^n times HSPCLKDIV 1,2,4..14) that fits in 16 bits
+    static const unsigned hspclkdiv[8] = {1, 2, 4, 6, 8, 10, 12, 14};
+    const uint64_t counts = (uint64_t)val * (EHRPWM_TBCLK_HZ / 1000000) / 1000;
+    unsigned best = 0, bestDiv = 0;
+    for(unsigned clk = 0; clk < 8; ++clk)
+        for(unsigned hsp = 0; hsp < 8; ++hsp)
+        {
+            unsigned div = (1u << clk) * hspclkdiv[hsp];
+            if(counts / div <= EHRPWM_MAX_COUNTS && (!bestDiv || div < bestDiv))
+            {
+                bestDiv = div;
+                best = (clk << TBCTL_CLKDIV_SHIFT) | (hsp << TBCTL_HSPCLKDIV_SHIFT);
+            }
+        }
+    if(!bestDiv || counts / bestDiv == 0)
+    {
+        std::cerr << "PWM period " << val << " ns out of range for " << _device << std::endl;
+        return false;
+    }
+
+    volatile uint16_t* tbctl = _regs.reg16(TBCTL);
+    *tbctl = (*tbctl & ~(TBCTL_DIV_MASK | TBCTL_CTRMODE_MASK)) | best | TBCTL_CTRMODE_UP;
+    *_regs.reg16(TBPRD) = counts / bestDiv - 1;
+
+    // counts per ns = TBCLK / div / 1e9, kept as a 0.32 fraction for set_duty
+    _countsPerNs = ((uint64_t)EHRPWM_TBCLK_HZ << 32) / bestDiv / 1000000000u;
+    return true;
+}
+
+bool MmapPwm::set_polarity(int val)
+{
+    _polarity = val;
+    if(_output)
+        *_regs.reg16(AQCTLB) = val ? (AQ_ZRO_CLEAR | AQ_CBU_SET) : (AQ_ZRO_SET | AQ_CBU_CLEAR);
+    else
+        *_regs.reg16(AQCTLA) = val ? (AQ_ZRO_CLEAR | AQ_CAU_SET) : (AQ_ZRO_SET | AQ_CAU_CLEAR);
+    return true;
+}
+
+bool MmapPwm::set_run(int val)
+{
+    // stopping forces the output low, the shared time base keeps counting
+    const int shift = _output ? 2 : 0;
+    volatile uint16_t* csfrc = _regs.reg16(AQCSFRC);
+    *csfrc = (*csfrc & ~(3 << shift)) | ((val ? 0 : 1) << shift);
+    return true;
+}
@@ -0,0 +1,134 @@
+#include "motionprofile.h"
+#include <algorithm>
+#include <math.h>
+
+MotionProfile::MotionProfile()
+    : _start(0), _dir(1), _distance(0), _jerk(0), _maxAccel(0),
+      _vPeak(0), _aPeak(0), _tJerk(0), _tAccel(0), _tCruise(0)
+{
+}
+
+void MotionProfile::plan(double start, double target, double maxVel, double maxAccel, double maxJerk)
+{
+    _start = start;
+    _dir = target < start ? -1 : 1;
+    _distance = fabs(target - start);
+    _jerk = maxJerk > 0 ? maxJerk : 0;
+    _maxAccel = maxAccel;
+    _tCruise = 0;
+
+    if(_distance == 0 || maxVel <= 0 || maxAccel <= 0)
+    {
+        _distance = 0;
+        _vPeak = _aPeak = _tJerk = _tAccel = 0;
+        return;
+    }
+
+    // accelerating to v and back down covers v * tAccel, which grows with v
+    accelPhase(maxVel);
+    if(_vPeak * _tAccel > _distance)
+    {
+        double lo = 0, hi = maxVel;
+        for(int i = 0; i < 60; ++i)
+        {
+            accelPhase((lo + hi) / 2);
+            if(_vPeak * _tAccel > _distance)
+                hi = _vPeak;
+            else
+                lo = _vPeak;
+        }
+        accelPhase(lo);
+    }
+    _tCruise = (_distance - _vPeak * _tAccel) / _vPeak;
+}
+
+void MotionProfile::accelPhase(double vPeak)
+{
+    _vPeak = vPeak;
+    if(_jerk > 0)
+    {
+        // peak acceleration is only reached if the jerk ramps leave room for it
+        _aPeak = std::min(_maxAccel, sqrt(vPeak * _jerk));
+        _tJerk = _aPeak / _jerk;
+    }
+    else
+    {
+        _aPeak = _maxAccel;
+        _tJerk = 0;
+    }
+    _tAccel = vPeak / _aPeak + _tJerk;
+}
+
+double MotionProfile::duration() const
+{
+    return 2 * _tAccel + _tCruise;
+}
+
+double MotionProfile::accelDistance(double t) const
+{
+    // distance covered t seconds into the acceleration phase
+    const double j = _jerk, a = _aPeak, tj = _tJerk;
+    if(tj == 0)
+        return a * t * t / 2;
+    if(t < tj)
+        return j * t * t * t / 6;
+
+    const double tc = _tAccel - 2 * tj;         // constant acceleration time
+    const double v1 = j * tj * tj / 2;
+    const double s1 = j * tj * tj * tj / 6;
+    if(t < tj + tc)
+    {
+        const double u = t - tj;
+        return s1 + v1 * u + a * u * u / 2;
+    }
+
+    const double u = t - tj - tc;
+    const double v2 = v1 + a * tc;
+    const double s2 = s1 + v1 * tc + a * tc * tc / 2;
+    return s2 + v2 * u + a * u * u / 2 - j * u * u * u / 6;
+}
+
+double MotionProfile::position(double t) const
+{
+    const double total = duration();
+    double s;
+    if(t <= 0 || _distance == 0)
+        s = 0;
+    else if(t >= total)
+        s = _distance;
+    else if(t < _tAccel)
+        s = accelDistance(t);
+    else if(t < _tAccel + _tCruise)
+        s = _vPeak * _tAccel / 2 + _vPeak * (t - _tAccel);
+    else
+        s = _distance - accelDistance(total - t);    // deceleration mirrors acceleration
+
+    return _start + _dir * s;
+}
+
+Trajectory::Trajectory()
+    : _next(0), _channel(NULL), _duty(NULL)
+{
+}
+
+std::vector<int>& Trajectory::samples()
+{
+    return _samples;
+}
+
+void Trajectory::start(PwmChannel* channel, int* duty)
+{
+    _channel = channel;
+    _duty = duty;
+    _next = 0;
+}
+
+bool Trajectory::tick()
+{
+    if(_next < _samples.size())
+    {
+        *_duty = _samples[_next++];
+        _channel->set_duty(*_duty);
+    }
+    return _next < _samples.size();
+}
@@ -0,0 +1,150 @@
+#include "motionscheduler.h"
+#include <algorithm>
+#include <errno.h>
+#include <iostream>
+#include <string.h>
+#include <time.h>
+
+MotionScheduler& MotionScheduler::instance()
+{
+    // never destroyed: the thread may still tick while statics are torn down
+    static MotionScheduler* scheduler = new MotionScheduler();
+    return *scheduler;
+}
+
+MotionScheduler::MotionScheduler()
+    : _current(NULL), _currentAdded(false), _tickNs(20000000), _started(false)
+{
+    pthread_mutex_init(&_mutex, NULL);
+    pthread_cond_init(&_wake, NULL);
+    pthread_cond_init(&_done, NULL);
+}
+
+void MotionScheduler::add(Task* task)
+{
+    pthread_mutex_lock(&_mutex);
+    if(std::find(_tasks.begin(), _tasks.end(), task) == _tasks.end())
+        _tasks.push_back(task);
+    // e.g. a new ramp target while the ramp ticks what it thinks is its last tick
+    if(task == _current)
+        _currentAdded = true;
+    task->_scheduled = true;
+
+    if(!_started)
+    {
+        int err = pthread_create(&_thread, NULL, &MotionScheduler::run, this);
+        if(err)
+            std::cerr << "Cannot start motion thread: " << strerror(err) << std::endl;
+        else
+            _started = true;
+    }
+    pthread_cond_signal(&_wake);
+    pthread_mutex_unlock(&_mutex);
+}
+
+void MotionScheduler::remove(Task* task)
+{
+    // the common case, e.g. every Servo::write() without a motion running
+    if(!task->_scheduled)
+        return;
+
+    pthread_mutex_lock(&_mutex);
+    std::vector<Task*>::iterator it = std::find(_tasks.begin(), _tasks.end(), task);
+    if(it != _tasks.end())
+        _tasks.erase(it);
+    task->_scheduled = false;
+    if(task == _current)
+        _currentAdded = false;
+
+    // let a tick in progress finish, unless this is that tick
+    while(task == _current && !pthread_equal(pthread_self(), _thread))
+        pthread_cond_wait(&_done, &_mutex);
+    pthread_cond_broadcast(&_done);
+    pthread_mutex_unlock(&_mutex);
+}
+
+bool MotionScheduler::active(Task* task)
+{
+    return task->_scheduled;
+}
+
+void MotionScheduler::wait(Task* task)
+{
+    pthread_mutex_lock(&_mutex);
+    while(std::find(_tasks.begin(), _tasks.end(), task) != _tasks.end())
+        pthread_cond_wait(&_done, &_mutex);
+    pthread_mutex_unlock(&_mutex);
+}
+
+void MotionScheduler::setTickNs(long ns)
+{
+    pthread_mutex_lock(&_mutex);
+    _tickNs = ns;
+    pthread_mutex_unlock(&_mutex);
+}
+
+long MotionScheduler::tickNs() const
+{
+    return _tickNs;
+}
+
+void* MotionScheduler::run(void* self)
+{
+    static_cast<MotionScheduler*>(self)->loop();
+    return NULL;
+}
+
+void MotionScheduler::loop()
+{
+    struct timespec next;
+    clock_gettime(CLOCK_MONOTONIC, &next);
+
+    pthread_mutex_lock(&_mutex);
+    for(;;)
+    {
+        if(_tasks.empty())
+        {
+            pthread_cond_wait(&_wake, &_mutex);
+            // first tick one period after the motion was started
+            clock_gettime(CLOCK_MONOTONIC, &next);
+        }
+        else
+        {
+            // tick a copy without the lock, tasks removed meanwhile are skipped
+            _ticking = _tasks;
+            for(size_t i = 0; i < _ticking.size(); ++i)
+            {
+                Task* task = _ticking[i];
+                if(!task->_scheduled)
+                    continue;
+
+                _current = task;
+                _currentAdded = false;
+                pthread_mutex_unlock(&_mutex);
+                const bool more = task->tick();
+                pthread_mutex_lock(&_mutex);
+                _current = NULL;
+
+                if(!more && !_currentAdded && task->_scheduled)
+                {
+                    _tasks.erase(std::find(_tasks.begin(), _tasks.end(), task));
+                    task->_scheduled = false;
+                }
+                pthread_cond_broadcast(&_done);
+            }
+        }
+
+        // absolute deadlines, so the tick does not drift with the work done
+        next.tv_nsec += _tickNs;
+        while(next.tv_nsec >= 1000000000)
+        {
+            next.tv_nsec -= 1000000000;
+            ++next.tv_sec;
+        }
+
+        pthread_mutex_unlock(&_mutex);
+        while(clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL) == EINTR)
+            ;
+        pthread_mutex_lock(&_mutex);
+    }
+}
@@ -3,76 +3,370 @@
 #include <fstream>
 #include <sstream>
 #include <exception>
+#include <math.h>
+#include <stdint.h>
+#include <time.h>
 
 MotorDriver::MotorDriver() 
+	: motor1dir(NULL), motor2dir(NULL), dirport(NULL), dirmask1(0), dirmask2(0),
+	  active(false), nextId(1), attached(false), ramped(false), dir1state(-1), dir2state(-1),
+	  wheelBase(0), wheelRadius(0), maxWheelSpeed(0),
+	  encoderLeft(NULL), encoderRight(NULL), countsPerRevLeft(0), countsPerRevRight(0)
 {
-	std::cout << " MotorDriver() is called" << std::endl;
+	pthread_mutex_init(&mutex, NULL);
+	timer = reactor.addTimer(&MotorDriver::onTimer, this);
 }
 
-void MotorDriver::init(){
-	std::cout << " MotorDriver::init() is called" << std::endl;
+void MotorDriver::init(BeagleBone::gpio::backend_t dirBackend){
 	MotorPwm::enablepwm();
 	
-	std::cout << " init motor 1 " << std::endl;
 	//init motor 1
 	motor1.attach("P9_14");
-	motor1dir = BeagleBone::gpio::P9(15);
+	motor1dir = BeagleBone::gpio::P9(15, dirBackend);
 	motor1dir->configure(BeagleBone::pin::OUT);
-	std::cout << " init motor 1 " << std::endl;
 	//init motor 2
 	motor2.attach("P9_16");
-	motor2dir = BeagleBone::gpio::P9(23);
+	motor2dir = BeagleBone::gpio::P9(23, dirBackend);
 	motor2dir->configure(BeagleBone::pin::OUT); 
+
+	// P9_15 and P9_23 are gpio1_16 and gpio1_17
+	dirport = NULL;
+	if(dirBackend == BeagleBone::gpio::MMAP && motor1dir && motor2dir
+	   && BeagleBone::gpio_port::of(motor1dir) == BeagleBone::gpio_port::of(motor2dir))
+	{
+		dirport = BeagleBone::gpio_port::of(motor1dir);
+		dirmask1 = BeagleBone::gpio_port::mask(motor1dir);
+		dirmask2 = BeagleBone::gpio_port::mask(motor2dir);
+	}
+
+	reactor.start();
+	attached = true;
 }
 
-void MotorDriver::forward(int milisec, int dutypercent){
-	std::cout << "MotorDriver::forward(int milisec, int dutypercent) is called" << std::endl;
-	motor1dir->set(1);
-	motor2dir->set(0);
-	motor1.write(dutypercent);
-	motor2.write(dutypercent);
-	sleep(milisec);
+void MotorDriver::setDirection(int dir1, int dir2){
+	if(dir1 == dir1state && dir2 == dir2state)
+		return;
+	dir1state = dir1;
+	dir2state = dir2;
+	if(dirport)
+	{
+		// SET then CLEAR: each store is atomic, a DATAOUT read-modify-write
+		// would race with the other writers of bank 1
+		const uint32_t high = (dir1 ? dirmask1 : 0) | (dir2 ? dirmask2 : 0);
+		const uint32_t low = (dirmask1 | dirmask2) & ~high;
+		if(high)
+			dirport->set(high);
+		if(low)
+			dirport->clear(low);
+		return;
+	}
+	motor1dir->set(dir1);
+	motor2dir->set(dir2);
 }
 
-void MotorDriver::backward(int milisec, int dutypercent){
-	
-	motor1dir->set(0);
-	motor2dir->set(1);
-	motor1.write(dutypercent);
-	motor2.write(dutypercent);
-	sleep(milisec);
+void MotorDriver::reverse1(bool forward, void* self){
+	MotorDriver* driver = (MotorDriver*)self;
+	driver->dir1state = forward;
+	if(driver->dirport)
+	{
+		if(forward)
+			driver->dirport->set(driver->dirmask1);
+		else
+			driver->dirport->clear(driver->dirmask1);
+	}
+	else
+		driver->motor1dir->set(forward);
 }
 
-void MotorDriver::turnleft(int milisec, int dutypercent){
-	motor1dir->set(0);
-	motor2dir->set(0);
-	motor1.write(dutypercent);
-	motor2.write(dutypercent);
-	sleep(milisec);
+void MotorDriver::reverse2(bool forward, void* self){
+	MotorDriver* driver = (MotorDriver*)self;
+	driver->dir2state = forward;
+	if(driver->dirport)
+	{
+		if(forward)
+			driver->dirport->set(driver->dirmask2);
+		else
+			driver->dirport->clear(driver->dirmask2);
+	}
+	else
+		driver->motor2dir->set(forward);
 }
 
-void MotorDriver::turnright(int milisec, int dutypercent){
-	motor1dir->set(1);
-	motor2dir->set(1);
-	motor1.write(dutypercent);
-	motor2.write(dutypercent);
-	sleep(milisec);
-	stop();
+void MotorDriver::setRamp(double upPerSec, double downPerSec, double reversalPerSec){
+	pthread_mutex_lock(&mutex);
+	motor1.setRamp(upPerSec, downPerSec, reversalPerSec);
+	motor2.setRamp(upPerSec, downPerSec, reversalPerSec);
+	ramped = upPerSec > 0 || downPerSec > 0;
+	motor1.onReverse(ramped ? &MotorDriver::reverse1 : NULL, this);
+	motor2.onReverse(ramped ? &MotorDriver::reverse2 : NULL, this);
+	pthread_mutex_unlock(&mutex);
 }
 
-void MotorDriver::stop(){
+int MotorDriver::forward(int milisec, int dutypercent, done_callback_t done, void* arg){
+	return submit(FORWARD, milisec, dutypercent, done, arg, true);
+}
+
+int MotorDriver::backward(int milisec, int dutypercent, done_callback_t done, void* arg){
+	return submit(BACKWARD, milisec, dutypercent, done, arg, true);
+}
+
+int MotorDriver::turnleft(int milisec, int dutypercent, done_callback_t done, void* arg){
+	return submit(TURNLEFT, milisec, dutypercent, done, arg, true);
+}
+
+int MotorDriver::turnright(int milisec, int dutypercent, done_callback_t done, void* arg){
+	return submit(TURNRIGHT, milisec, dutypercent, done, arg, true);
+}
+
+int MotorDriver::enqueue(maneuver_t what, int milisec, int dutypercent, done_callback_t done, void* arg){
+	return submit(what, milisec, dutypercent, done, arg, false);
+}
+
+int MotorDriver::submit(maneuver_t what, int milisec, int dutypercent, done_callback_t done, void* arg, bool preempt){
+	Maneuver m;
+	m.what = what;
+	m.milisec = milisec;
+	m.dutypercent = dutypercent;
+	m.done = done;
+	m.arg = arg;
+	m.endNs = UINT64_MAX;
+
+	std::vector<Maneuver> cancelled;
+	pthread_mutex_lock(&mutex);
+	m.id = nextId++;
+	if(preempt)
+		takeAll(cancelled);
+	if(active)
+		queue.push_back(m);
+	else
+		begin(m);
+	pthread_mutex_unlock(&mutex);
+
+	// outside the lock, a callback may submit the next maneuver
+	for(size_t i = 0; i < cancelled.size(); ++i)
+		if(cancelled[i].done)
+			cancelled[i].done(cancelled[i].id, false, cancelled[i].arg);
+	return m.id;
+}
+
+void MotorDriver::begin(Maneuver& m){
+	int dir1 = 0, dir2 = 0;
+	switch(m.what)
+	{
+	case FORWARD:   dir1 = 1; dir2 = 0; break;
+	case BACKWARD:  dir1 = 0; dir2 = 1; break;
+	case TURNLEFT:  dir1 = 0; dir2 = 0; break;
+	case TURNRIGHT: dir1 = 1; dir2 = 1; break;
+	}
+	if(ramped)
+	{
+		// a positive target drives the direction pin high
+		motor1.setTarget(dir1 ? m.dutypercent : -m.dutypercent);
+		motor2.setTarget(dir2 ? m.dutypercent : -m.dutypercent);
+	}
+	else
+	{
+		setDirection(dir1, dir2);
+		motor1.write(m.dutypercent);
+		motor2.write(m.dutypercent);
+	}
+
+	if(m.milisec > 0)
+	{
+		struct timespec now;
+		clock_gettime(CLOCK_MONOTONIC, &now);
+		m.endNs = (uint64_t)now.tv_sec * 1000000000u + now.tv_nsec + m.milisec * 1000000ull;
+		reactor.armTimer(timer, (int64_t)m.milisec * 1000000);
+	}
+	else
+	{
+		m.endNs = UINT64_MAX;
+		reactor.armTimer(timer, 0);
+	}
+	current = m;
+	active = true;
+}
+
+void MotorDriver::halt(){
+	// duty 0 rather than stop(), so the next maneuver runs without re-enabling
+	if(ramped)
+	{
+		motor1.setTarget(0);
+		motor2.setTarget(0);
+		return;
+	}
 	motor1.write(0);
-	motor1.stop();
 	motor2.write(0);
-	motor2.stop();
+}
+
+void MotorDriver::takeAll(std::vector<Maneuver>& cancelled){
+	if(active)
+		cancelled.push_back(current);
+	cancelled.insert(cancelled.end(), queue.begin(), queue.end());
+	queue.clear();
+	active = false;
+}
+
+void MotorDriver::onTimer(uint64_t, uint64_t timestampNs, void* self){
+	MotorDriver* driver = (MotorDriver*)self;
+
+	pthread_mutex_lock(&driver->mutex);
+	// woken for a maneuver that has been preempted since
+	if(!driver->active || timestampNs < driver->current.endNs)
+	{
+		pthread_mutex_unlock(&driver->mutex);
+		return;
+	}
+
+	Maneuver finished = driver->current;
+	driver->active = false;
+	if(!driver->queue.empty())
+	{
+		Maneuver next = driver->queue.front();
+		driver->queue.pop_front();
+		driver->begin(next);
+	}
+	else
+	{
+		driver->halt();
+	}
+	pthread_mutex_unlock(&driver->mutex);
+
+	if(finished.done)
+		finished.done(finished.id, true, finished.arg);
+}
+
+void MotorDriver::setGeometry(double wheelBaseM, double wheelRadiusM, double maxWheelRadPerSec){
+	pthread_mutex_lock(&mutex);
+	wheelBase = wheelBaseM;
+	wheelRadius = wheelRadiusM;
+	maxWheelSpeed = maxWheelRadPerSec;
+	odom.setWheelBase(wheelBaseM);
+	if(encoderLeft && encoderRight)
+		odom.setMetersPerCount(2 * M_PI * wheelRadius / countsPerRevLeft, 2 * M_PI * wheelRadius / countsPerRevRight);
+	pthread_mutex_unlock(&mutex);
+}
+
+void MotorDriver::setEncoders(Encoder* left, Encoder* right, double countsPerRevLeft, double countsPerRevRight){
+	if((left == NULL) != (right == NULL) || (left && (countsPerRevLeft == 0 || countsPerRevRight == 0)))
+	{
+		std::cerr << "MotorDriver::setEncoders() needs both encoders and their counts per revolution" << std::endl;
+		return;
+	}
+	pthread_mutex_lock(&mutex);
+	encoderLeft = left;
+	encoderRight = right;
+	this->countsPerRevLeft = countsPerRevLeft;
+	this->countsPerRevRight = countsPerRevRight;
+	if(left)
+		odom.setMetersPerCount(2 * M_PI * wheelRadius / countsPerRevLeft, 2 * M_PI * wheelRadius / countsPerRevRight);
+	pthread_mutex_unlock(&mutex);
+}
+
+void MotorDriver::updateOdometry(){
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	const uint64_t now = (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+
+	if(encoderLeft)
+	{
+		odom.updateCounts(encoderLeft->position(), encoderRight->position(), now);
+		return;
+	}
+
+	// the sign of a motor is its direction pin, the right one is mirrored
+	pthread_mutex_lock(&mutex);
+	const double scale = maxWheelSpeed * wheelRadius / MAX_SPEED;
+	const double left = fabs(motor1.output()) * (dir1state == 0 ? -scale : scale);
+	const double right = fabs(motor2.output()) * (dir2state == 0 ? scale : -scale);
+	pthread_mutex_unlock(&mutex);
+	odom.updateSpeeds(left, right, now);
+}
+
+Odometry& MotorDriver::odometry(){
+	return odom;
+}
+
+void MotorDriver::setVelocity(double v, double omega){
+	if(wheelRadius <= 0 || maxWheelSpeed <= 0)
+	{
+		std::cerr << "MotorDriver::setVelocity() needs setGeometry() first" << std::endl;
+		return;
+	}
+
+	// wheel speeds as a percentage of duty, motor1 is the left wheel
+	const double scale = MAX_SPEED / (maxWheelSpeed * wheelRadius);
+	double left = (v - omega * wheelBase / 2) * scale;
+	double right = (v + omega * wheelBase / 2) * scale;
+
+	// scale both wheels to keep the ratio, i.e. the curvature
+	const double peak = fabs(left) > fabs(right) ? fabs(left) : fabs(right);
+	if(peak > MAX_SPEED)
+	{
+		left *= MAX_SPEED / peak;
+		right *= MAX_SPEED / peak;
+	}
+
+	std::vector<Maneuver> cancelled;
+	pthread_mutex_lock(&mutex);
+	if(active)
+	{
+		takeAll(cancelled);
+		reactor.armTimer(timer, 0);
+	}
+
+	// the right motor is mirrored: its direction pin is low going forward
+	if(ramped)
+	{
+		motor1.setTarget(left);
+		motor2.setTarget(-right);
+	}
+	else
+	{
+		// duties that did not change are elided by the PWM channels
+		setDirection(left >= 0, right < 0);
+		motor1.setTarget(fabs(left));
+		motor2.setTarget(fabs(right));
+	}
+	pthread_mutex_unlock(&mutex);
+
+	for(size_t i = 0; i < cancelled.size(); ++i)
+		if(cancelled[i].done)
+			cancelled[i].done(cancelled[i].id, false, cancelled[i].arg);
+}
+
+bool MotorDriver::busy(){
+	pthread_mutex_lock(&mutex);
+	bool b = active;
+	pthread_mutex_unlock(&mutex);
+	return b;
+}
+
+void MotorDriver::stop(){
+	std::vector<Maneuver> cancelled;
+	pthread_mutex_lock(&mutex);
+	takeAll(cancelled);
+	reactor.armTimer(timer, 0);
+	// keep run set: maneuvers and setVelocity() only write the duty
+	halt();
+	pthread_mutex_unlock(&mutex);
+
+	for(size_t i = 0; i < cancelled.size(); ++i)
+		if(cancelled[i].done)
+			cancelled[i].done(cancelled[i].id, false, cancelled[i].arg);
 }
 
 void MotorDriver::detach(){
+	if(!attached)
+		return;
+	attached = false;
+	reactor.stop();
 	motor1.detach();
 	motor2.detach();
 }
 
 MotorDriver::~MotorDriver(){
-	motor1.detach();
-	motor2.detach();
-}
\ No newline at end of file
+	detach();
+	reactor.stop();
+	pthread_mutex_destroy(&mutex);
+}
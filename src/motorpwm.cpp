@@ -3,25 +3,41 @@
 #include <fstream>
 #include <sstream>
 #include <exception>
+#include <math.h>
 #include <stdlib.h> 
+
+#include "sysfsattr.h"
+
 MotorPwm::MotorPwm() 
-    : _duty(0),  _run(0)
+    : _attached(false), _duty(0),  _run(0), forced(false),
+      _output(0), _reverse(NULL), _reverseArg(NULL)
 {
-	std::cout << " MotorPwm() is called" << std::endl;
+    _ramp.setOutput(&MotorPwm::rampOutput, this);
+}
+
+void MotorPwm::attach(const std::string& pin, PwmChannel::backend_t backend)
+{
+    const Pins::PwmPin* pwm = Pins::findPwm(pin);
+    if(pwm == NULL)
+    {
+        std::cerr << "Invalid pin name " << pin << std::endl;
+        _attached = false;
+        return;
+    }
+    attachDevice(pwm->name, pwm->device, backend);
 }
 
-void MotorPwm::attach(const std::string& pin)
+void MotorPwm::attachDevice(const char* pin, const char* device, PwmChannel::backend_t backend)
 {
-	std::cout << " MotorPwm::attach(const std::string& pin) is called" << std::endl;
-    std::string filename = pinToFile(pin); // should throw an exception when something's wrong with the pin name
+    // open the device once, it stays open until detach()
+    if(!_channel.open(device, backend))
+    {
+        _attached = false;
+        return;
+    }
 
     // check if the pwm device is not used by someone else
-    std::stringstream sysfsfile_request;
-    sysfsfile_request << SYSFS_EHRPWM_PREFIX << filename << "/" << SYSFS_EHRPWM_REQUEST;
-    std::ifstream req_file(sysfsfile_request.str().c_str());
-    std::string req_status;
-    std::getline(req_file, req_status);
-    std::cout << "MotorPwm attach req status: " << req_status << std::endl;
+    std::string req_status = _channel.requestStatus();
     if(req_status.find("free") == std::string::npos)
     {
         //throw std::exception();
@@ -32,26 +48,10 @@ void MotorPwm::attach(const std::string& pin)
     {
         _attached = true; 
     }
-    
-    // if everything is okay we can move forward with opening the other files 
-    std::stringstream sysfsfile_duty;
-    std::stringstream sysfsfile_period;
-    std::stringstream sysfsfile_polarity;
-    std::stringstream sysfsfile_run;
-
-    sysfsfile_duty << SYSFS_EHRPWM_PREFIX << filename << "/" << SYSFS_EHRPWM_DUTY_PERC;
-    sysfsfile_period << SYSFS_EHRPWM_PREFIX << filename << "/" << SYSFS_EHRPWM_PERIOD_FREQUENCY;
-    sysfsfile_run << SYSFS_EHRPWM_PREFIX << filename << "/" << SYSFS_EHRPWM_RUN;
-
-    _filename_request = sysfsfile_request.str();
-    _filename_duty = sysfsfile_duty.str();
-    _filename_period = sysfsfile_period.str();
-    _filename_run = sysfsfile_run.str();
-
 
     set_request(1);    
     set_run(0);
-    set_period(PWM_FREQUENCY);
+    set_period(_PERIOD);
     set_duty(0); // initialize to 0 degree
 	set_run(1);
     _pin = pin;
@@ -59,13 +59,18 @@ void MotorPwm::attach(const std::string& pin)
 
 void MotorPwm::write(int value)
 {
-	std::cout << "writing " << value << std::endl;
     if(_attached)
     {
        if (value>MAX_SPEED) value= MAX_SPEED;
-	   std::cout << "MotorPwm::write(int value) " << value << std::endl;
-	   set_duty(value); // micro -> nano
+       if(_ramp.enabled())
+       {
+           _ramp.setTarget(value);
+           return;
+       }
+	   _duty = dutyFor(value);
+	   set_duty(_duty); // percent -> nano
        _lastValue = value;
+       _output = value;
     }
     else 
     {
@@ -108,6 +113,8 @@ void MotorPwm::stop()
 {
     if(_attached)
     {
+        _ramp.reset(0);
+        _output = 0;
         set_run(0);
         _run = 0;
     }
@@ -121,8 +128,11 @@ void MotorPwm::detach()
 {
     if(_attached)
     {
+        _ramp.reset(0);
+        _output = 0;
         set_run(0);
         set_request(0);
+        _channel.close();
         _attached = false;
     }
     else 
@@ -142,24 +152,88 @@ std::string MotorPwm::toString() const
     return ss.str();
 }
 
+unsigned long MotorPwm::writesIssued() const
+{
+    return _channel.writesIssued();
+}
+
+unsigned long MotorPwm::writesElided() const
+{
+    return _channel.writesElided();
+}
+
+LatencyHistogram::Stats MotorPwm::latencyStats() const
+{
+    return _channel.latencyStats();
+}
+
+void MotorPwm::resetLatencyStats()
+{
+    _channel.resetLatencyStats();
+}
+
+void MotorPwm::setRamp(double upPerSec, double downPerSec, double reversalPerSec)
+{
+    _ramp.setRates(upPerSec, downPerSec, reversalPerSec);
+    if(!_ramp.enabled())
+        _ramp.reset(_output);
+}
+
+void MotorPwm::setTarget(double value)
+{
+    if(value > MAX_SPEED) value = MAX_SPEED;
+    if(value < -MAX_SPEED) value = -MAX_SPEED;
+    if(_ramp.enabled())
+        _ramp.setTarget(value);
+    else
+        rampOutput(value, this);
+}
+
+double MotorPwm::target() const
+{
+    return _ramp.enabled() ? _ramp.target() : _output.load();
+}
+
+double MotorPwm::output() const
+{
+    return _output;
+}
+
+void MotorPwm::onReverse(void (*callback)(bool forward, void* arg), void* arg)
+{
+    _reverse = callback;
+    _reverseArg = arg;
+}
+
+void MotorPwm::rampOutput(double value, void* self)
+{
+    MotorPwm* motor = (MotorPwm*)self;
+    if(!motor->_attached)
+        return;
+
+    // a ramp always passes through 0 to reverse, a jump may not
+    const double output = motor->_output;
+    if(value != 0 && motor->_reverse
+       && (output == 0 || (value > 0) != (output > 0)))
+        motor->_reverse(value > 0, motor->_reverseArg);
+
+    motor->_duty = (int)(fabs(value) * (_PERIOD / 100));
+    motor->set_duty(motor->_duty);
+    motor->_lastValue = fabs(value);
+    motor->_output = value;
+}
+
+int MotorPwm::dutyFor(int value) const
+{
+    if (value>MAX_SPEED) value= MAX_SPEED;
+    return value * (_PERIOD / 100);
+}
 
 void MotorPwm::set_request(const int val) 
 {
     if(_attached)
     {
-				//set the value
-				std::stringstream ss ;
-				std::cout << "set duty request to " << val << std::endl;
-                ss<<"echo " << val << " > " << _filename_request;
-                system(ss.str().c_str());
-				//get the setted value
-				std::ifstream req_file(_filename_request.c_str());
-                std::string req_status;
-				std::getline(req_file, req_status);
-				std::cout << "setted value: " << req_status << std::endl;
-				/*ss.str(std::string());
-				ss << val ;
-				return ss.compare(req_status)== 0 */
+        _channel.set_request(val);
     }
     else if(forced)
     {
@@ -180,19 +254,7 @@ void MotorPwm::set_duty(const int val)
 {
     if(_attached)
     {
-                //set the value
-				std::cout << "MotorPwm::set_duty(const int val) " << val << std::endl;
-				std::stringstream ss ;
-                ss << "echo " << val <<" > " << _filename_duty;
-                system(ss.str().c_str());
-				//get the setted value
-				std::ifstream duty_file(_filename_duty.c_str());
-				std::string duty_status;
-				std::getline(duty_file, duty_status);
-				std::cout << "setted value: " <<duty_status << std::endl;
-				/*ss.str(std::string());
-				ss << val ;
-				return ss.compare(duty_status) == 0 */
+        _channel.set_duty(val);
     }
     else if(forced)
     {
@@ -212,17 +274,7 @@ void MotorPwm::set_period(const int val)
 {
     if(_attached)
     {
-				std::cout << "set period value to: " << val << std::endl;
-				std::stringstream ss ;
-				ss << "echo " << val << " > " << _filename_period;
-				system(ss.str().c_str());
-				std::ifstream period_file(_filename_period.c_str());
-				std::string period_status;
-				std::getline(period_file, period_status);
-				std::cout << "setted value: " << period_status << std::endl;
-				/*ss.str(std::string());
-				ss << val ;
-				return ss.compare(period_status) == 0 */
+        _channel.set_period(val);
     }
     else if(forced)
     {
@@ -242,17 +294,7 @@ void MotorPwm::set_run(const int val)
 {
     if(_attached)
     {
-			std::cout << " set run value to: "<< val << std::endl;
-			std::stringstream ss ;
-			ss << "echo " << val << " > " << _filename_run;
-			system(ss.str().c_str());
-			std::ifstream run_file(_filename_run.c_str());
-			std::string run_status;
-			std::getline(run_file, run_status);
-			std::cout << " get run value: " << run_status << std::endl;
-			/*ss.str(std::string());
-			ss << val ;
-			return ss.compare(run_status) == 0 */
+        _channel.set_run(val);
     }
     else if(forced)
     {
@@ -279,6 +321,10 @@ MotorPwm::~MotorPwm()
 
 void MotorPwm::enablepwm()
 {
+	// the script muxes the real board, a fake sysfs tree needs nothing
+	if(!SysfsAttr::root().empty())
+		return;
+
 	std::stringstream ss ;
 	//std::cout << "current dir: "<<get_currentdirectory() << std::endl;
     //ss << "python " << get_currentdirectory() <<"pwm.py" << std::endl;
@@ -287,27 +333,3 @@ void MotorPwm::enablepwm()
 	std::cout << ss.str().c_str();
 	system(ss.str().c_str());
 }
-
-std::string MotorPwm::pinToFile(const std::string& pin) 
-{
-    if(pin == "P8_13")
-        return "ehrpwm.2:1";
-    else if(pin == "P8_19")
-        return "ehrpwm.2:0";
-    else if(pin == "P9_14")
-        return "ehrpwm.1:0";
-    else if(pin == "P9_16")
-        return "ehrpwm.1:1";
-    else if(pin == "P9_31")
-        return "ehrpwm.0:0";
-    else if(pin == "P9_29")
-        return "ehrpwm.0:1";
-    else if(pin == "P9_42")
-        return "ecap.0";
-    else if(pin == "P9_28")
-        return "ecap.2";
-    else 
-//        throw std::exception();
-        std::cerr << "Invalid pin name" << std::endl;
-
-}
\ No newline at end of file
@@ -0,0 +1,108 @@
+#include "odometry.h"
+#include <math.h>
+
+Odometry::Odometry()
+    : _wheelBase(0), _metersPerCountLeft(0), _metersPerCountRight(0), _seq(0)
+{
+    reset();
+}
+
+void Odometry::setWheelBase(double meters)
+{
+    _wheelBase = meters;
+}
+
+void Odometry::setMetersPerCount(double left, double right)
+{
+    _metersPerCountLeft = left;
+    _metersPerCountRight = right;
+}
+
+void Odometry::reset(double x, double y, double theta)
+{
+    _haveCounts = false;
+    _left = 0;
+    _right = 0;
+    _x = x;
+    _y = y;
+    _theta = theta;
+    _timestampNs = 0;
+    publish(x, y, theta, 0, 0, 0);
+}
+
+void Odometry::updateCounts(int32_t left, int32_t right, uint64_t timestampNs)
+{
+    if(!_haveCounts)
+    {
+        _haveCounts = true;
+        _left = left;
+        _right = right;
+        _timestampNs = timestampNs;
+        return;
+    }
+
+    // wrapping differences, the counters are free running
+    const int32_t dl = (int32_t)((uint32_t)left - (uint32_t)_left);
+    const int32_t dr = (int32_t)((uint32_t)right - (uint32_t)_right);
+    _left = left;
+    _right = right;
+    updateTravel(dl * _metersPerCountLeft, dr * _metersPerCountRight, timestampNs);
+}
+
+void Odometry::updateSpeeds(double left, double right, uint64_t timestampNs)
+{
+    const double dt = _timestampNs ? (timestampNs - _timestampNs) * 1e-9 : 0;
+    updateTravel(left * dt, right * dt, timestampNs);
+}
+
+void Odometry::updateTravel(double left, double right, uint64_t timestampNs)
+{
+    const double ds = (left + right) / 2;
+    const double dtheta = _wheelBase > 0 ? (right - left) / _wheelBase : 0;
+
+    // chord of the arc: ds * sin(k)/k along the mean heading, k = dtheta/2
+    const double k = dtheta / 2;
+    const double chord = fabs(k) < 1e-4 ? 1 - k * k / 6 : sin(k) / k;
+    _x += ds * chord * cos(_theta + k);
+    _y += ds * chord * sin(_theta + k);
+    _theta = remainder(_theta + dtheta, 2 * M_PI);
+
+    const double dt = _timestampNs ? (timestampNs - _timestampNs) * 1e-9 : 0;
+    _timestampNs = timestampNs;
+    publish(_x, _y, _theta, dt > 0 ? ds / dt : 0, dt > 0 ? dtheta / dt : 0, timestampNs);
+}
+
+void Odometry::publish(double x, double y, double theta, double v, double omega, uint64_t timestampNs)
+{
+    const uint32_t seq = _seq.load(std::memory_order_relaxed);
+    _seq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    _pubX.store(x, std::memory_order_relaxed);
+    _pubY.store(y, std::memory_order_relaxed);
+    _pubTheta.store(theta, std::memory_order_relaxed);
+    _pubV.store(v, std::memory_order_relaxed);
+    _pubOmega.store(omega, std::memory_order_relaxed);
+    _pubTimestampNs.store(timestampNs, std::memory_order_relaxed);
+
+    _seq.store(seq + 2, std::memory_order_release);
+}
+
+Odometry::Pose Odometry::pose() const
+{
+    Pose p;
+    uint32_t before, after;
+    do
+    {
+        before = _seq.load(std::memory_order_acquire);
+        p.x = _pubX.load(std::memory_order_relaxed);
+        p.y = _pubY.load(std::memory_order_relaxed);
+        p.theta = _pubTheta.load(std::memory_order_relaxed);
+        p.v = _pubV.load(std::memory_order_relaxed);
+        p.omega = _pubOmega.load(std::memory_order_relaxed);
+        p.timestampNs = _pubTimestampNs.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        after = _seq.load(std::memory_order_relaxed);
+    } while((before & 1) || before != after);
+    return p;
+}
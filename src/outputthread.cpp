@@ -0,0 +1,182 @@
+#include "outputthread.h"
+#include <iostream>
+#include <new>
+#include <stdlib.h>
+#include <time.h>
+
+static inline uint64_t now_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+OutputThread::OutputThread(int64_t periodNs)
+    : _loop(periodNs), _applied(0), _maxLatencyNs(0)
+{
+    _loop.add(&OutputThread::cycle, this);
+}
+
+OutputThread::~OutputThread()
+{
+    stop();
+    for(size_t i = 0; i < _lanes.size(); ++i)
+    {
+        _lanes[i]->~Lane();
+        free(_lanes[i]);
+    }
+}
+
+void* OutputThread::operator new(size_t size)
+{
+    void* mem = NULL;
+    if(posix_memalign(&mem, alignof(OutputThread), size) != 0)
+        throw std::bad_alloc();
+    return mem;
+}
+
+void OutputThread::operator delete(void* ptr)
+{
+    free(ptr);
+}
+
+int OutputThread::addServo(Servo* servo)
+{
+    return add(servo, NULL, NULL);
+}
+
+int OutputThread::addMotor(MotorPwm* motor)
+{
+    return add(NULL, motor, NULL);
+}
+
+int OutputThread::addGpio(BeagleBone::gpio* pin)
+{
+    return add(NULL, NULL, pin);
+}
+
+int OutputThread::add(Servo* servo, MotorPwm* motor, BeagleBone::gpio* pin)
+{
+    if(_loop.running())
+    {
+        std::cerr << "OutputThread: cannot add an output to a running thread" << std::endl;
+        return -1;
+    }
+
+    Output out;
+    out.servo = servo;
+    out.motor = motor;
+    out.pin = pin;
+    _outputs.push_back(out);
+    return _outputs.size() - 1;
+}
+
+OutputThread::Lane* OutputThread::addProducer()
+{
+    if(_loop.running())
+    {
+        std::cerr << "OutputThread: cannot add a producer to a running thread" << std::endl;
+        return NULL;
+    }
+
+    // C++11 new ignores the cache line alignment of the queue indices
+    void* mem = NULL;
+    if(posix_memalign(&mem, alignof(Lane), sizeof(Lane)) != 0)
+    {
+        std::cerr << "OutputThread: cannot allocate a producer lane" << std::endl;
+        return NULL;
+    }
+    Lane* lane = new(mem) Lane();
+    _lanes.push_back(lane);
+    return lane;
+}
+
+bool OutputThread::post(int channel, int value)
+{
+    Command cmd;
+    cmd.channel = channel;
+    cmd.value = value;
+    cmd.timestamp = now_ns();
+    return _queue.push(cmd);
+}
+
+bool OutputThread::post(Lane* lane, int channel, int value)
+{
+    Command cmd;
+    cmd.channel = channel;
+    cmd.value = value;
+    cmd.timestamp = now_ns();
+    return lane->push(cmd);
+}
+
+ControlLoop& OutputThread::loop()
+{
+    return _loop;
+}
+
+bool OutputThread::start()
+{
+    return _loop.start();
+}
+
+void OutputThread::stop()
+{
+    _loop.stop();
+}
+
+size_t OutputThread::depth() const
+{
+    size_t depth = _queue.depth();
+    for(size_t i = 0; i < _lanes.size(); ++i)
+        depth += _lanes[i]->depth();
+    return depth;
+}
+
+unsigned long OutputThread::drops() const
+{
+    unsigned long drops = _queue.drops();
+    for(size_t i = 0; i < _lanes.size(); ++i)
+        drops += _lanes[i]->drops();
+    return drops;
+}
+
+unsigned long OutputThread::applied() const
+{
+    return _applied;
+}
+
+long OutputThread::maxLatencyNs() const
+{
+    return _maxLatencyNs;
+}
+
+void OutputThread::cycle(void* self)
+{
+    OutputThread* out = static_cast<OutputThread*>(self);
+    Command cmd;
+
+    while(out->_queue.pop(cmd))
+        out->apply(cmd);
+    for(size_t i = 0; i < out->_lanes.size(); ++i)
+        while(out->_lanes[i]->pop(cmd))
+            out->apply(cmd);
+}
+
+void OutputThread::apply(const Command& cmd)
+{
+    if(cmd.channel < 0 || cmd.channel >= (int)_outputs.size())
+        return;
+
+    const Output& out = _outputs[cmd.channel];
+    if(out.servo)
+        out.servo->write(cmd.value);
+    else if(out.motor)
+        out.motor->write(cmd.value);
+    else
+        out.pin->set(cmd.value);
+
+    const long latency = now_ns() - cmd.timestamp;
+    if(latency > _maxLatencyNs.load(std::memory_order_relaxed))
+        _maxLatencyNs.store(latency, std::memory_order_relaxed);
+    _applied.store(_applied.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
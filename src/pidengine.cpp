@@ -0,0 +1,219 @@
+#include "pidengine.h"
+#include <iostream>
+#include <math.h>
+
+PidEngine::PidEngine(int64_t periodNs)
+    : _dt(periodNs * 1e-9f), _loop(periodNs)
+{
+    _loop.add(&PidEngine::cycle, this);
+}
+
+PidEngine::~PidEngine()
+{
+    stop();
+}
+
+int PidEngine::addMotor(MotorPwm* motor, feedback_t feedback, void* arg)
+{
+    return add(motor, NULL, feedback, arg, -MAX_SPEED, MAX_SPEED, MIN_SPEED);
+}
+
+int PidEngine::addServo(Servo* servo, feedback_t feedback, void* arg)
+{
+    // the engine owns the servo from now on, a running motion would fight it
+    if(servo)
+        servo->cancelMotion();
+    return add(NULL, servo, feedback, arg, 0, 180, 0);
+}
+
+int PidEngine::addAxis(feedback_t feedback, void* arg)
+{
+    return add(NULL, NULL, feedback, arg, -1e30f, 1e30f, 0);
+}
+
+int PidEngine::add(MotorPwm* motor, Servo* servo, feedback_t feedback, void* arg,
+                   float outMin, float outMax, float deadband)
+{
+    if(_loop.running())
+    {
+        std::cerr << "PidEngine: cannot add an axis to a running engine" << std::endl;
+        return -1;
+    }
+
+    Binding b;
+    b.motor = motor;
+    b.servo = servo;
+    b.feedback = feedback;
+    b.arg = arg;
+    _bindings.push_back(b);
+    _target.emplace_back(0.0f);
+
+    _kp.push_back(0);
+    _ki.push_back(0);
+    _kd.push_back(0);
+    _kff.push_back(0);
+    _alpha.push_back(1);
+    _min.push_back(outMin);
+    _max.push_back(outMax);
+    _deadband.push_back(deadband);
+    _setpoint.push_back(0);
+    _measurement.push_back(0);
+    _previous.push_back(0);
+    _integral.push_back(0);
+    _derivative.push_back(0);
+    _output.push_back(0);
+    return _bindings.size() - 1;
+}
+
+void PidEngine::setGains(int axis, float kp, float ki, float kd, float kff)
+{
+    _kp[axis] = kp;
+    _ki[axis] = ki;
+    _kd[axis] = kd;
+    _kff[axis] = kff;
+}
+
+void PidEngine::setDerivativeFilter(int axis, float tauSec)
+{
+    _alpha[axis] = _dt / (tauSec + _dt);
+}
+
+void PidEngine::setLimits(int axis, float outMin, float outMax, float deadband)
+{
+    _min[axis] = outMin;
+    _max[axis] = outMax;
+    _deadband[axis] = deadband;
+}
+
+void PidEngine::setSetpoint(int axis, float setpoint)
+{
+    _target[axis].store(setpoint, std::memory_order_relaxed);
+}
+
+float PidEngine::output(int axis) const
+{
+    return _output[axis];
+}
+
+size_t PidEngine::axes() const
+{
+    return _bindings.size();
+}
+
+float* PidEngine::setpoints()
+{
+    return _setpoint.data();
+}
+
+float* PidEngine::measurement()
+{
+    return _measurement.data();
+}
+
+void PidEngine::step()
+{
+    const size_t n = _bindings.size();
+    for(size_t i = 0; i < n; ++i)
+    {
+        _setpoint[i] = _target[i].load(std::memory_order_relaxed);
+        if(_bindings[i].feedback)
+            _measurement[i] = _bindings[i].feedback(_bindings[i].arg);
+    }
+
+    update();
+
+    for(size_t i = 0; i < n; ++i)
+    {
+        if(_bindings[i].motor)
+            _bindings[i].motor->setTarget(_output[i]);
+        else if(_bindings[i].servo && _bindings[i].servo->_attached)
+        {
+            // not through Servo::write(): its cancelMotion() may take the
+            // MotionScheduler lock on this thread
+            Servo* servo = _bindings[i].servo;
+            servo->_duty = servo->dutyFor((double)_output[i]);
+            servo->_lastValue = _output[i];
+            servo->_channel.set_duty(servo->_duty);
+        }
+    }
+}
+
+void PidEngine::update()
+{
+    const size_t n = _bindings.size();
+    const float dt = _dt;
+    const float inv_dt = 1 / _dt;
+
+    const float* kp = _kp.data();
+    const float* ki = _ki.data();
+    const float* kd = _kd.data();
+    const float* kff = _kff.data();
+    const float* alpha = _alpha.data();
+    const float* lo = _min.data();
+    const float* hi = _max.data();
+    const float* deadband = _deadband.data();
+    const float* sp = _setpoint.data();
+    const float* meas = _measurement.data();
+    float* prev = _previous.data();
+    float* integral = _integral.data();
+    float* deriv = _derivative.data();
+    float* out = _output.data();
+
+    // the arrays never overlap, so the axes can be updated in SIMD lanes
+#pragma GCC ivdep
+    for(size_t i = 0; i < n; ++i)
+    {
+        const float e = sp[i] - meas[i];
+
+        // derivative of the measurement, low-pass filtered
+        deriv[i] += alpha[i] * ((prev[i] - meas[i]) * inv_dt - deriv[i]);
+        prev[i] = meas[i];
+
+        const float in = integral[i] + ki[i] * e * dt;
+        const float u = kff[i] * sp[i] + kp[i] * e + in + kd[i] * deriv[i];
+        const float above = u > lo[i] ? u : lo[i];
+        const float clamped = above < hi[i] ? above : hi[i];
+
+        // back-calculation: the integrator gives up what the clamp cut off
+        integral[i] = in + (clamped - u);
+
+        const float mag = fabsf(clamped);
+        const float raised = mag < deadband[i] ? deadband[i] : mag;
+        out[i] = copysignf(mag > 0 ? raised : 0, clamped);
+    }
+}
+
+void PidEngine::reset()
+{
+    for(size_t i = 0; i < _bindings.size(); ++i)
+    {
+        _previous[i] = _measurement[i];
+        _integral[i] = 0;
+        _derivative[i] = 0;
+    }
+}
+
+ControlLoop& PidEngine::loop()
+{
+    return _loop;
+}
+
+bool PidEngine::start()
+{
+    // start from the current measurements, so the derivative does not kick
+    for(size_t i = 0; i < _bindings.size(); ++i)
+        if(_bindings[i].feedback)
+            _measurement[i] = _bindings[i].feedback(_bindings[i].arg);
+    reset();
+    return _loop.start();
+}
+
+void PidEngine::stop()
+{
+    _loop.stop();
+}
+
+void PidEngine::cycle(void* self)
+{
+    static_cast<PidEngine*>(self)->step();
+}
@@ -24,9 +24,10 @@
 
 #include "pinmux.hpp"
 #include "gpio.hpp"
+#include "sysfsattr.h"
 
 //
-// Where are the pin control devices?
+// Where are the pin control devices? (relative to SysfsAttr::root())
 //
 static const char* const devdir = "/sys/kernel/debug/omap_mux";
 
@@ -38,7 +39,7 @@ namespace BeagleBone {
 class unmuxed_fct: public pin_fct
 {
 public:
-  unmuxed_fct(const char * name) :
+  constexpr unmuxed_fct(const char * name) :
     pin_fct(name)
   {
   }
@@ -53,7 +54,7 @@ public:
 class unmuxed_pin: public pin
 {
 public:
-  unmuxed_pin(const char *     name,
+  constexpr unmuxed_pin(const char *     name,
 	      unmuxed_fct *    fct,
 	      pin::direction_t dir = pin::IN,
 	      pin::pull_t      pulls = pin::NONE) :
@@ -87,21 +88,21 @@ public:
 };
 
 
-static unmuxed_fct GND        = unmuxed_fct("GND");
-static unmuxed_fct VDD_3V3EXP = unmuxed_fct("VDD_3V3EXP");
-static unmuxed_fct VDD_5V     = unmuxed_fct("VDD_5V");
-static unmuxed_fct SYS_5V     = unmuxed_fct("SYS_5V");
-static unmuxed_fct PWR_BUT    = unmuxed_fct("PWR_BUT");
-static unmuxed_fct SYS_RESETn = unmuxed_fct("SYS_RESETn");
-static unmuxed_fct VADC       = unmuxed_fct("VADC");
-static unmuxed_fct AGND       = unmuxed_fct("AGND");
-static unmuxed_fct AIN0       = unmuxed_fct("AIN0");
-static unmuxed_fct AIN1       = unmuxed_fct("AIN1");
-static unmuxed_fct AIN2       = unmuxed_fct("AIN2");
-static unmuxed_fct AIN3       = unmuxed_fct("AIN3");
-static unmuxed_fct AIN4       = unmuxed_fct("AIN4");
-static unmuxed_fct AIN5       = unmuxed_fct("AIN5");
-static unmuxed_fct AIN6       = unmuxed_fct("AIN6");
+static unmuxed_fct GND       ("GND");
+static unmuxed_fct VDD_3V3EXP("VDD_3V3EXP");
+static unmuxed_fct VDD_5V    ("VDD_5V");
+static unmuxed_fct SYS_5V    ("SYS_5V");
+static unmuxed_fct PWR_BUT   ("PWR_BUT");
+static unmuxed_fct SYS_RESETn("SYS_RESETn");
+static unmuxed_fct VADC      ("VADC");
+static unmuxed_fct AGND      ("AGND");
+static unmuxed_fct AIN0      ("AIN0");
+static unmuxed_fct AIN1      ("AIN1");
+static unmuxed_fct AIN2      ("AIN2");
+static unmuxed_fct AIN3      ("AIN3");
+static unmuxed_fct AIN4      ("AIN4");
+static unmuxed_fct AIN5      ("AIN5");
+static unmuxed_fct AIN6      ("AIN6");
 
 
   //
@@ -113,404 +114,945 @@ static unmuxed_fct AIN6       = unmuxed_fct("AIN6");
   //
 
 
-pin_fct* const pin_fct::clkout2         = new pin_fct("clkout2");
-pin_fct* const pin_fct::d_can0_rx       = new pin_fct("d_can0_rx");
-pin_fct* const pin_fct::d_can0_tx       = new pin_fct("d_can0_tx");
-pin_fct* const pin_fct::d_can1_rx       = new pin_fct("d_can1_rx");
-pin_fct* const pin_fct::d_can1_tx       = new pin_fct("d_can1_tx");
-pin_fct* const pin_fct::eQEP2A_in       = new pin_fct("eQEP2A_in");
-pin_fct* const pin_fct::ecap0_in_pwm0_out = new pin_fct("ecap0_in_pwm0_out");
-pin_fct* const pin_fct::ecap2_in_pwm2_out = new pin_fct("ecap2_in_pwm2_out");
-pin_fct* const pin_fct::ehrpwm0A        = new pin_fct("ehrpwm0A");
-pin_fct* const pin_fct::ehrpwm0B        = new pin_fct("ehrpwm0B");
-pin_fct* const pin_fct::ehrpwm0_synco   = new pin_fct("ehrpwm0_synco");
-pin_fct* const pin_fct::ehrpwm1A        = new pin_fct("ehrpwm1A");
-pin_fct* const pin_fct::ehrpwm1B        = new pin_fct("ehrpwm1B");
-pin_fct* const pin_fct::ehrpwm1_tripzone_input = new pin_fct("ehrpwm1_tripzone_input");
-pin_fct* const pin_fct::ehrpwm2A        = new pin_fct("ehrpwm2A");
-pin_fct* const pin_fct::ehrpwm2B        = new pin_fct("ehrpwm2B");
-pin_fct* const pin_fct::ehrpwm2_tripzone_input = new pin_fct("ehrpwm2_tripzone_input");
-pin_fct* const pin_fct::eqep2B_in       = new pin_fct("eqep2B_in");
-pin_fct* const pin_fct::eqep2_index     = new pin_fct("eqep2_index");
-pin_fct* const pin_fct::eqep2_strobe    = new pin_fct("eqep2_strobe");
-pin_fct* const pin_fct::eqep2a_in       = new pin_fct("eqep2a_in");
-pin_fct* const pin_fct::eqep2b_in       = new pin_fct("eqep2b_in");
-pin_fct* const pin_fct::gmii2_rxdv      = new pin_fct("gmii2_rxdv");
-pin_fct* const pin_fct::gmii2_txd2      = new pin_fct("gmii2_txd2");
-pin_fct* const pin_fct::gmii2_txd3      = new pin_fct("gmii2_txd3");
-pin_fct* const pin_fct::gmii2_txen      = new pin_fct("gmii2_txen");
-pin_fct* const pin_fct::gpio0_10        = new pin_fct("gpio0_10");
-pin_fct* const pin_fct::gpio0_11        = new pin_fct("gpio0_11");
-pin_fct* const pin_fct::gpio0_12        = new pin_fct("gpio0_12");
-pin_fct* const pin_fct::gpio0_13        = new pin_fct("gpio0_13");
-pin_fct* const pin_fct::gpio0_14        = new pin_fct("gpio0_14");
-pin_fct* const pin_fct::gpio0_15        = new pin_fct("gpio0_15");
-pin_fct* const pin_fct::gpio0_2         = new pin_fct("gpio0_2");
-pin_fct* const pin_fct::gpio0_20        = new pin_fct("gpio0_20");
-pin_fct* const pin_fct::gpio0_22        = new pin_fct("gpio0_22");
-pin_fct* const pin_fct::gpio0_23        = new pin_fct("gpio0_23");
-pin_fct* const pin_fct::gpio0_26        = new pin_fct("gpio0_26");
-pin_fct* const pin_fct::gpio0_27        = new pin_fct("gpio0_27");
-pin_fct* const pin_fct::gpio0_3         = new pin_fct("gpio0_3");
-pin_fct* const pin_fct::gpio0_30        = new pin_fct("gpio0_30");
-pin_fct* const pin_fct::gpio0_31        = new pin_fct("gpio0_31");
-pin_fct* const pin_fct::gpio0_4         = new pin_fct("gpio0_4");
-pin_fct* const pin_fct::gpio0_5         = new pin_fct("gpio0_5");
-pin_fct* const pin_fct::gpio0_7         = new pin_fct("gpio0_7");
-pin_fct* const pin_fct::gpio0_8         = new pin_fct("gpio0_8");
-pin_fct* const pin_fct::gpio0_9         = new pin_fct("gpio0_9");
-pin_fct* const pin_fct::gpio1_0         = new pin_fct("gpio1_0");
-pin_fct* const pin_fct::gpio1_1         = new pin_fct("gpio1_1");
-pin_fct* const pin_fct::gpio1_12        = new pin_fct("gpio1_12");
-pin_fct* const pin_fct::gpio1_13        = new pin_fct("gpio1_13");
-pin_fct* const pin_fct::gpio1_14        = new pin_fct("gpio1_14");
-pin_fct* const pin_fct::gpio1_15        = new pin_fct("gpio1_15");
-pin_fct* const pin_fct::gpio1_16        = new pin_fct("gpio1_16");
-pin_fct* const pin_fct::gpio1_17        = new pin_fct("gpio1_17");
-pin_fct* const pin_fct::gpio1_18        = new pin_fct("gpio1_18");
-pin_fct* const pin_fct::gpio1_19        = new pin_fct("gpio1_19");
-pin_fct* const pin_fct::gpio1_2         = new pin_fct("gpio1_2");
-pin_fct* const pin_fct::gpio1_28        = new pin_fct("gpio1_28");
-pin_fct* const pin_fct::gpio1_29        = new pin_fct("gpio1_29");
-pin_fct* const pin_fct::gpio1_3         = new pin_fct("gpio1_3");
-pin_fct* const pin_fct::gpio1_30        = new pin_fct("gpio1_30");
-pin_fct* const pin_fct::gpio1_31        = new pin_fct("gpio1_31");
-pin_fct* const pin_fct::gpio1_4         = new pin_fct("gpio1_4");
-pin_fct* const pin_fct::gpio1_5         = new pin_fct("gpio1_5");
-pin_fct* const pin_fct::gpio1_6         = new pin_fct("gpio1_6");
-pin_fct* const pin_fct::gpio1_7         = new pin_fct("gpio1_7");
-pin_fct* const pin_fct::gpio2_1         = new pin_fct("gpio2_1");
-pin_fct* const pin_fct::gpio2_10        = new pin_fct("gpio2_10");
-pin_fct* const pin_fct::gpio2_11        = new pin_fct("gpio2_11");
-pin_fct* const pin_fct::gpio2_12        = new pin_fct("gpio2_12");
-pin_fct* const pin_fct::gpio2_13        = new pin_fct("gpio2_13");
-pin_fct* const pin_fct::gpio2_14        = new pin_fct("gpio2_14");
-pin_fct* const pin_fct::gpio2_15        = new pin_fct("gpio2_15");
-pin_fct* const pin_fct::gpio2_16        = new pin_fct("gpio2_16");
-pin_fct* const pin_fct::gpio2_17        = new pin_fct("gpio2_17");
-pin_fct* const pin_fct::gpio2_22        = new pin_fct("gpio2_22");
-pin_fct* const pin_fct::gpio2_23        = new pin_fct("gpio2_23");
-pin_fct* const pin_fct::gpio2_24        = new pin_fct("gpio2_24");
-pin_fct* const pin_fct::gpio2_25        = new pin_fct("gpio2_25");
-pin_fct* const pin_fct::gpio2_3         = new pin_fct("gpio2_3");
-pin_fct* const pin_fct::gpio2_4         = new pin_fct("gpio2_4");
-pin_fct* const pin_fct::gpio2_5         = new pin_fct("gpio2_5");
-pin_fct* const pin_fct::gpio2_6         = new pin_fct("gpio2_6");
-pin_fct* const pin_fct::gpio2_7         = new pin_fct("gpio2_7");
-pin_fct* const pin_fct::gpio2_8         = new pin_fct("gpio2_8");
-pin_fct* const pin_fct::gpio2_9         = new pin_fct("gpio2_9");
-pin_fct* const pin_fct::gpio3_14        = new pin_fct("gpio3_14");
-pin_fct* const pin_fct::gpio3_15        = new pin_fct("gpio3_15");
-pin_fct* const pin_fct::gpio3_16        = new pin_fct("gpio3_16");
-pin_fct* const pin_fct::gpio3_17        = new pin_fct("gpio3_17");
-pin_fct* const pin_fct::gpio3_19        = new pin_fct("gpio3_19");
-pin_fct* const pin_fct::gpio3_21        = new pin_fct("gpio3_21");
-pin_fct* const pin_fct::gpmc_a0         = new pin_fct("gpmc_a0");
-pin_fct* const pin_fct::gpmc_a1         = new pin_fct("gpmc_a1");
-pin_fct* const pin_fct::gpmc_a10        = new pin_fct("gpmc_a10");
-pin_fct* const pin_fct::gpmc_a11        = new pin_fct("gpmc_a11");
-pin_fct* const pin_fct::gpmc_a12        = new pin_fct("gpmc_a12");
-pin_fct* const pin_fct::gpmc_a13        = new pin_fct("gpmc_a13");
-pin_fct* const pin_fct::gpmc_a14        = new pin_fct("gpmc_a14");
-pin_fct* const pin_fct::gpmc_a15        = new pin_fct("gpmc_a15");
-pin_fct* const pin_fct::gpmc_a16        = new pin_fct("gpmc_a16");
-pin_fct* const pin_fct::gpmc_a17        = new pin_fct("gpmc_a17");
-pin_fct* const pin_fct::gpmc_a18        = new pin_fct("gpmc_a18");
-pin_fct* const pin_fct::gpmc_a19        = new pin_fct("gpmc_a19");
-pin_fct* const pin_fct::gpmc_a2         = new pin_fct("gpmc_a2");
-pin_fct* const pin_fct::gpmc_a3         = new pin_fct("gpmc_a3");
-pin_fct* const pin_fct::gpmc_a4         = new pin_fct("gpmc_a4");
-pin_fct* const pin_fct::gpmc_a5         = new pin_fct("gpmc_a5");
-pin_fct* const pin_fct::gpmc_a6         = new pin_fct("gpmc_a6");
-pin_fct* const pin_fct::gpmc_a7         = new pin_fct("gpmc_a7");
-pin_fct* const pin_fct::gpmc_a8         = new pin_fct("gpmc_a8");
-pin_fct* const pin_fct::gpmc_a9         = new pin_fct("gpmc_a9");
-pin_fct* const pin_fct::gpmc_ad0        = new pin_fct("gpmc_ad0");
-pin_fct* const pin_fct::gpmc_ad1        = new pin_fct("gpmc_ad1");
-pin_fct* const pin_fct::gpmc_ad10       = new pin_fct("gpmc_ad10");
-pin_fct* const pin_fct::gpmc_ad11       = new pin_fct("gpmc_ad11");
-pin_fct* const pin_fct::gpmc_ad12       = new pin_fct("gpmc_ad12");
-pin_fct* const pin_fct::gpmc_ad13       = new pin_fct("gpmc_ad13");
-pin_fct* const pin_fct::gpmc_ad14       = new pin_fct("gpmc_ad14");
-pin_fct* const pin_fct::gpmc_ad15       = new pin_fct("gpmc_ad15");
-pin_fct* const pin_fct::gpmc_ad2        = new pin_fct("gpmc_ad2");
-pin_fct* const pin_fct::gpmc_ad3        = new pin_fct("gpmc_ad3");
-pin_fct* const pin_fct::gpmc_ad4        = new pin_fct("gpmc_ad4");
-pin_fct* const pin_fct::gpmc_ad5        = new pin_fct("gpmc_ad5");
-pin_fct* const pin_fct::gpmc_ad6        = new pin_fct("gpmc_ad6");
-pin_fct* const pin_fct::gpmc_ad7        = new pin_fct("gpmc_ad7");
-pin_fct* const pin_fct::gpmc_ad8        = new pin_fct("gpmc_ad8");
-pin_fct* const pin_fct::gpmc_ad9        = new pin_fct("gpmc_ad9");
-pin_fct* const pin_fct::gpmc_advn_ale   = new pin_fct("gpmc_advn_ale");
-pin_fct* const pin_fct::gpmc_be1n       = new pin_fct("gpmc_be1n");
-pin_fct* const pin_fct::gpmc_ben0_cle   = new pin_fct("gpmc_ben0_cle");
-pin_fct* const pin_fct::gpmc_ben1       = new pin_fct("gpmc_ben1");
-pin_fct* const pin_fct::gpmc_clk        = new pin_fct("gpmc_clk");
-pin_fct* const pin_fct::gpmc_csn0       = new pin_fct("gpmc_csn0");
-pin_fct* const pin_fct::gpmc_csn1       = new pin_fct("gpmc_csn1");
-pin_fct* const pin_fct::gpmc_csn2       = new pin_fct("gpmc_csn2");
-pin_fct* const pin_fct::gpmc_oen_ren    = new pin_fct("gpmc_oen_ren");
-pin_fct* const pin_fct::gpmc_wait0      = new pin_fct("gpmc_wait0");
-pin_fct* const pin_fct::gpmc_wen        = new pin_fct("gpmc_wen");
-pin_fct* const pin_fct::gpmc_wpn        = new pin_fct("gpmc_wpn");
-pin_fct* const pin_fct::i2c1_scl        = new pin_fct("i2c1_scl");
-pin_fct* const pin_fct::i2c1_sda        = new pin_fct("i2c1_sda");
-pin_fct* const pin_fct::i2c2_scl        = new pin_fct("i2c2_scl");
-pin_fct* const pin_fct::i2c2_sda        = new pin_fct("i2c2_sda");
-pin_fct* const pin_fct::lcd_ac_bias_en  = new pin_fct("lcd_ac_bias_en");
-pin_fct* const pin_fct::lcd_data0       = new pin_fct("lcd_data0");
-pin_fct* const pin_fct::lcd_data1       = new pin_fct("lcd_data1");
-pin_fct* const pin_fct::lcd_data10      = new pin_fct("lcd_data10");
-pin_fct* const pin_fct::lcd_data11      = new pin_fct("lcd_data11");
-pin_fct* const pin_fct::lcd_data12      = new pin_fct("lcd_data12");
-pin_fct* const pin_fct::lcd_data13      = new pin_fct("lcd_data13");
-pin_fct* const pin_fct::lcd_data14      = new pin_fct("lcd_data14");
-pin_fct* const pin_fct::lcd_data15      = new pin_fct("lcd_data15");
-pin_fct* const pin_fct::lcd_data16      = new pin_fct("lcd_data16");
-pin_fct* const pin_fct::lcd_data17      = new pin_fct("lcd_data17");
-pin_fct* const pin_fct::lcd_data18      = new pin_fct("lcd_data18");
-pin_fct* const pin_fct::lcd_data19      = new pin_fct("lcd_data19");
-pin_fct* const pin_fct::lcd_data2       = new pin_fct("lcd_data2");
-pin_fct* const pin_fct::lcd_data20      = new pin_fct("lcd_data20");
-pin_fct* const pin_fct::lcd_data21      = new pin_fct("lcd_data21");
-pin_fct* const pin_fct::lcd_data22      = new pin_fct("lcd_data22");
-pin_fct* const pin_fct::lcd_data23      = new pin_fct("lcd_data23");
-pin_fct* const pin_fct::lcd_data3       = new pin_fct("lcd_data3");
-pin_fct* const pin_fct::lcd_data4       = new pin_fct("lcd_data4");
-pin_fct* const pin_fct::lcd_data5       = new pin_fct("lcd_data5");
-pin_fct* const pin_fct::lcd_data6       = new pin_fct("lcd_data6");
-pin_fct* const pin_fct::lcd_data7       = new pin_fct("lcd_data7");
-pin_fct* const pin_fct::lcd_data8       = new pin_fct("lcd_data8");
-pin_fct* const pin_fct::lcd_data9       = new pin_fct("lcd_data9");
-pin_fct* const pin_fct::lcd_hsync       = new pin_fct("lcd_hsync");
-pin_fct* const pin_fct::lcd_memory_clk_mux = new pin_fct("lcd_memory_clk_mux");
-pin_fct* const pin_fct::lcd_pclk        = new pin_fct("lcd_pclk");
-pin_fct* const pin_fct::lcd_vsync       = new pin_fct("lcd_vsync");
-pin_fct* const pin_fct::mcasp0_aclkr    = new pin_fct("mcasp0_aclkr");
-pin_fct* const pin_fct::mcasp0_aclkx    = new pin_fct("mcasp0_aclkx");
-pin_fct* const pin_fct::mcasp0_ahclkr   = new pin_fct("mcasp0_ahclkr");
-pin_fct* const pin_fct::mcasp0_ahclkx   = new pin_fct("mcasp0_ahclkx");
-pin_fct* const pin_fct::mcasp0_axr0     = new pin_fct("mcasp0_axr0");
-pin_fct* const pin_fct::mcasp0_axr1     = new pin_fct("mcasp0_axr1");
-pin_fct* const pin_fct::mcasp0_axr2     = new pin_fct("mcasp0_axr2");
-pin_fct* const pin_fct::mcasp0_axr3     = new pin_fct("mcasp0_axr3");
-pin_fct* const pin_fct::mcasp0_fsr      = new pin_fct("mcasp0_fsr");
-pin_fct* const pin_fct::mcasp0_fsx      = new pin_fct("mcasp0_fsx");
-pin_fct* const pin_fct::mcasp1_axr1     = new pin_fct("mcasp1_axr1");
-pin_fct* const pin_fct::mcasp1_fsx      = new pin_fct("mcasp1_fsx");
-pin_fct* const pin_fct::mii2_col        = new pin_fct("mii2_col");
-pin_fct* const pin_fct::mii2_crs        = new pin_fct("mii2_crs");
-pin_fct* const pin_fct::mii2_rxerr      = new pin_fct("mii2_rxerr");
-pin_fct* const pin_fct::mmc0_sdcd       = new pin_fct("mmc0_sdcd");
-pin_fct* const pin_fct::mmc0_sdwp       = new pin_fct("mmc0_sdwp");
-pin_fct* const pin_fct::mmc1_clk        = new pin_fct("mmc1_clk");
-pin_fct* const pin_fct::mmc1_cmd        = new pin_fct("mmc1_cmd");
-pin_fct* const pin_fct::mmc1_dat0       = new pin_fct("mmc1_dat0");
-pin_fct* const pin_fct::mmc1_dat1       = new pin_fct("mmc1_dat1");
-pin_fct* const pin_fct::mmc1_dat2       = new pin_fct("mmc1_dat2");
-pin_fct* const pin_fct::mmc1_dat3       = new pin_fct("mmc1_dat3");
-pin_fct* const pin_fct::mmc1_dat4       = new pin_fct("mmc1_dat4");
-pin_fct* const pin_fct::mmc1_dat5       = new pin_fct("mmc1_dat5");
-pin_fct* const pin_fct::mmc1_dat6       = new pin_fct("mmc1_dat6");
-pin_fct* const pin_fct::mmc1_dat7       = new pin_fct("mmc1_dat7");
-pin_fct* const pin_fct::mmc1_sdcd       = new pin_fct("mmc1_sdcd");
-pin_fct* const pin_fct::mmc1_sdwp       = new pin_fct("mmc1_sdwp");
-pin_fct* const pin_fct::mmc2_clk        = new pin_fct("mmc2_clk");
-pin_fct* const pin_fct::mmc2_dat0       = new pin_fct("mmc2_dat0");
-pin_fct* const pin_fct::mmc2_dat1       = new pin_fct("mmc2_dat1");
-pin_fct* const pin_fct::mmc2_dat2       = new pin_fct("mmc2_dat2");
-pin_fct* const pin_fct::mmc2_dat3       = new pin_fct("mmc2_dat3");
-pin_fct* const pin_fct::mmc2_dat4       = new pin_fct("mmc2_dat4");
-pin_fct* const pin_fct::mmc2_dat5       = new pin_fct("mmc2_dat5");
-pin_fct* const pin_fct::mmc2_dat6       = new pin_fct("mmc2_dat6");
-pin_fct* const pin_fct::mmc2_dat7       = new pin_fct("mmc2_dat7");
-pin_fct* const pin_fct::mmc2_sdcd       = new pin_fct("mmc2_sdcd");
-pin_fct* const pin_fct::mmc2_sdwp       = new pin_fct("mmc2_sdwp");
-pin_fct* const pin_fct::rgmii2_rctl     = new pin_fct("rgmii2_rctl");
-pin_fct* const pin_fct::rgmii2_tctl     = new pin_fct("rgmii2_tctl");
-pin_fct* const pin_fct::rgmii2_td2      = new pin_fct("rgmii2_td2");
-pin_fct* const pin_fct::rgmii2_td3      = new pin_fct("rgmii2_td3");
-pin_fct* const pin_fct::rmii2_crs_dv    = new pin_fct("rmii2_crs_dv");
-pin_fct* const pin_fct::rmii2_rxerr     = new pin_fct("rmii2_rxerr");
-pin_fct* const pin_fct::rmii2_txen      = new pin_fct("rmii2_txen");
-pin_fct* const pin_fct::spi0_cs0        = new pin_fct("spi0_cs0");
-pin_fct* const pin_fct::spi0_d0         = new pin_fct("spi0_d0");
-pin_fct* const pin_fct::spi0_d1         = new pin_fct("spi0_d1");
-pin_fct* const pin_fct::spi0_sclk       = new pin_fct("spi0_sclk");
-pin_fct* const pin_fct::spi1_cs0        = new pin_fct("spi1_cs0");
-pin_fct* const pin_fct::spi1_cs1        = new pin_fct("spi1_cs1");
-pin_fct* const pin_fct::spi1_d0         = new pin_fct("spi1_d0");
-pin_fct* const pin_fct::spi1_d1         = new pin_fct("spi1_d1");
-pin_fct* const pin_fct::spi1_sclk       = new pin_fct("spi1_sclk");
-pin_fct* const pin_fct::uart1_ctsn      = new pin_fct("uart1_ctsn");
-pin_fct* const pin_fct::uart1_rtsn      = new pin_fct("uart1_rtsn");
-pin_fct* const pin_fct::uart1_rxd       = new pin_fct("uart1_rxd");
-pin_fct* const pin_fct::uart1_txd       = new pin_fct("uart1_txd");
-pin_fct* const pin_fct::uart2_ctsn      = new pin_fct("uart2_ctsn");
-pin_fct* const pin_fct::uart2_rtsn      = new pin_fct("uart2_rtsn");
-pin_fct* const pin_fct::uart2_rxd       = new pin_fct("uart2_rxd");
-pin_fct* const pin_fct::uart2_txd       = new pin_fct("uart2_txd");
-pin_fct* const pin_fct::uart3_ctsn      = new pin_fct("uart3_ctsn");
-pin_fct* const pin_fct::uart3_txd       = new pin_fct("uart3_txd");
-pin_fct* const pin_fct::xdma_event_intr1 = new pin_fct("xdma_event_intr1");
-pin_fct* const pin_fct::xdma_event_intr2 = new pin_fct("xdma_event_intr2");
-
-
-pin* pin::m_P8[46] = {new unmuxed_pin("P8_1", &GND, pin::OUT, pin::NONE),
-		      new unmuxed_pin("P8_2", &GND, pin::OUT, pin::NONE),
-		      new gpio("P8_3", "gpmc_ad6"  ,  1, 6, pin_fct::gpmc_ad6       , pin_fct::mmc1_dat6      , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , pin_fct::gpio1_6        ,7, pin::IN, pin::NONE),
-		      new gpio("P8_4", "gpmc_ad7"  ,  1, 7, pin_fct::gpmc_ad7       , pin_fct::mmc1_dat7      , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , pin_fct::gpio1_7        ,0, pin::IN, pin::NONE),
-		      new gpio("P8_5", "gpmc_ad2"  ,  1, 2, pin_fct::gpmc_ad2       , pin_fct::mmc1_dat2      , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , pin_fct::gpio1_2        ,0, pin::IN, pin::NONE),
-		      new gpio("P8_6", "gpmc_ad3"  ,  1, 3, pin_fct::gpmc_ad3       , pin_fct::mmc1_dat3      , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , pin_fct::gpio1_3        ,7, pin::IN, pin::NONE),
- /* ? */	      new pin("P8_7", "gpmc_advn_ale",  pin_fct::gpmc_advn_ale  , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    ,0, pin::OUT, pin::NONE),
-                      new gpio("P8_8", "gpmc_oen_ren",  2, 3, pin_fct::gpmc_oen_ren   , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , pin_fct::gpio2_3        ,0, pin::OUT, pin::NONE),
-		      new gpio("P8_9", "gpmc_ben0_cle",  2, 5, pin_fct::gpmc_ben0_cle  , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , pin_fct::gpio2_5        ,0, pin::OUT, pin::NONE),
-		      new gpio("P8_10", "gpmc_wen"  ,  2, 4, pin_fct::gpmc_wen       , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , pin_fct::gpio2_4        ,0, pin::OUT, pin::NONE),
-		      new gpio("P8_11", "gpmc_ad13" ,  1, 13, pin_fct::gpmc_ad13      , pin_fct::lcd_data18     , pin_fct::mmc1_dat5      , pin_fct::mmc2_dat1      , pin_fct::eqep2B_in      , NULL                    , NULL                    , pin_fct::gpio1_13       ,7, pin::IN, pin::NONE),
-		      new gpio("P8_12", "gpmc_ad12" ,  1, 12, pin_fct::gpmc_ad12      , pin_fct::lcd_data19     , pin_fct::mmc1_dat4      , pin_fct::mmc2_dat0      , pin_fct::eqep2a_in      , NULL                    , NULL                    , pin_fct::gpio1_12       ,7, pin::IN, pin::NONE),
-		      new gpio("P8_13", "gpmc_ad9"  ,  0, 23, pin_fct::gpmc_ad9       , pin_fct::lcd_data22     , pin_fct::mmc1_dat1      , pin_fct::mmc2_dat5      , pin_fct::ehrpwm2B       , NULL                    , NULL                    , pin_fct::gpio0_23       ,7, pin::IN, pin::NONE),
-		      new gpio("P8_14", "gpmc_ad10" ,  0, 26, pin_fct::gpmc_ad10      , pin_fct::lcd_data21     , pin_fct::mmc1_dat2      , pin_fct::mmc2_dat6      , pin_fct::ehrpwm2_tripzone_input , NULL                    , NULL                    , pin_fct::gpio0_26       ,7, pin::IN, pin::NONE),
-		      new gpio("P8_15", "gpmc_ad15" ,  1, 15, pin_fct::gpmc_ad15      , pin_fct::lcd_data16     , pin_fct::mmc1_dat7      , pin_fct::mmc2_dat3      , pin_fct::eqep2_strobe   , NULL                    , NULL                    , pin_fct::gpio1_15       ,7, pin::IN, pin::NONE),
-		      new gpio("P8_16", "gpmc_ad14" ,  1, 14, pin_fct::gpmc_ad14      , pin_fct::lcd_data17     , pin_fct::mmc1_dat6      , pin_fct::mmc2_dat2      , pin_fct::eqep2_index    , NULL                    , NULL                    , pin_fct::gpio1_14       ,7, pin::IN, pin::NONE),
-		      new gpio("P8_17", "gpmc_ad11" ,  0, 27, pin_fct::gpmc_ad11      , pin_fct::lcd_data20     , pin_fct::mmc1_dat3      , pin_fct::mmc2_dat7      , pin_fct::ehrpwm0_synco  , NULL                    , NULL                    , pin_fct::gpio0_27       ,7, pin::IN, pin::NONE),
-		      new gpio("P8_18", "gpmc_clk"  ,  2, 1,  pin_fct::gpmc_clk       , pin_fct::lcd_memory_clk_mux , NULL                    , pin_fct::mmc2_clk       , NULL                    , NULL                    , pin_fct::mcasp0_fsr     , pin_fct::gpio2_1        ,7, pin::IN, pin::NONE),
-		      new gpio("P8_19", "gpmc_ad8"  ,  0, 22, pin_fct::gpmc_ad8       , pin_fct::lcd_data23     , pin_fct::mmc1_dat0      , pin_fct::mmc2_dat4      , pin_fct::ehrpwm2A       , NULL                    , NULL                    , pin_fct::gpio0_22       ,7, pin::IN, pin::NONE),
-		      new gpio("P8_20", "gpmc_csn2" ,  1, 31, pin_fct::gpmc_csn2      , pin_fct::gpmc_be1n      , pin_fct::mmc1_cmd       , NULL                    , NULL                    , NULL                    , NULL                    , pin_fct::gpio1_31       ,7, pin::IN, pin::NONE),
-		      new gpio("P8_21", "gpmc_csn1" ,  1, 30, pin_fct::gpmc_csn1      , pin_fct::gpmc_clk       , pin_fct::mmc1_clk       , NULL                    , NULL                    , NULL                    , NULL                    , pin_fct::gpio1_30       ,7, pin::IN, pin::NONE),
-		      new gpio("P8_22", "gpmc_ad5"  ,  1, 5 , pin_fct::gpmc_ad5       , pin_fct::mmc1_dat5      , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , pin_fct::gpio1_5        ,0, pin::IN, pin::NONE),
-		      new gpio("P8_23", "gpmc_ad4"  ,  1, 4 , pin_fct::gpmc_ad4       , pin_fct::mmc1_dat4      , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , pin_fct::gpio1_4        ,0, pin::IN, pin::NONE),
-		      new gpio("P8_24", "gpmc_ad1"  ,  1, 1 , pin_fct::gpmc_ad1       , pin_fct::mmc1_dat1      , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , pin_fct::gpio1_1        ,0, pin::IN, pin::NONE),
-		      new gpio("P8_25", "gpmc_ad0"  ,  1, 0 , pin_fct::gpmc_ad0       , pin_fct::mmc1_dat0      , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , pin_fct::gpio1_0        ,0, pin::IN, pin::NONE),
-		      new gpio("P8_26", "gpmc_csn0" ,  1, 29, pin_fct::gpmc_csn0      , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , pin_fct::gpio1_29       ,0, pin::OUT, pin::NONE),
-		      new gpio("P8_27", "lcd_vsync" ,  2, 22, pin_fct::lcd_vsync      , pin_fct::gpmc_a8        , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , pin_fct::gpio2_22       ,7, pin::IN, pin::NONE),
-		      new gpio("P8_28", "lcd_pclk"  ,  2, 24, pin_fct::lcd_pclk       , pin_fct::gpmc_a10       , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , pin_fct::gpio2_24       ,7, pin::IN, pin::NONE),
-		      new gpio("P8_29", "lcd_hsync" ,  2, 23, pin_fct::lcd_hsync      , pin_fct::gpmc_a9        , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , pin_fct::gpio2_23       ,7, pin::IN, pin::NONE),
-		      new gpio("P8_30", "lcd_ac_bias_en",  2, 25, pin_fct::lcd_ac_bias_en , pin_fct::gpmc_a11       , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , pin_fct::gpio2_25       ,7, pin::IN, pin::NONE),
-		      new gpio("P8_31", "lcd_data14",  0, 10, pin_fct::lcd_data14     , pin_fct::gpmc_a18       , NULL                    , pin_fct::mcasp0_axr1    , NULL                    , NULL                    , NULL                    , pin_fct::gpio0_10       ,0, pin::OUT, pin::NONE),
-		      new gpio("P8_32", "lcd_data15",  0, 11, pin_fct::lcd_data15     , pin_fct::gpmc_a19       , NULL                    , pin_fct::mcasp0_ahclkx  , pin_fct::mcasp0_axr3    , NULL                    , NULL                    , pin_fct::gpio0_11       ,0, pin::OUT, pin::NONE),
-		      new gpio("P8_33", "lcd_data13",  0, 9 , pin_fct::lcd_data13     , pin_fct::gpmc_a17       , NULL                    , pin_fct::mcasp0_fsr     , pin_fct::mcasp0_axr3    , NULL                    , NULL                    , pin_fct::gpio0_9        ,0, pin::OUT, pin::NONE),
-		      new gpio("P8_34", "lcd_data11",  2, 17, pin_fct::lcd_data11     , pin_fct::gpmc_a15       , NULL                    , pin_fct::mcasp0_ahclkr  , pin_fct::mcasp0_axr2    , NULL                    , NULL                    , pin_fct::gpio2_17       ,0, pin::OUT, pin::NONE),
-		      new gpio("P8_35", "lcd_data12",  0, 8 , pin_fct::lcd_data12     , pin_fct::gpmc_a16       , NULL                    , pin_fct::mcasp0_aclkr   , pin_fct::mcasp0_axr2    , NULL                    , NULL                    , pin_fct::gpio0_8        ,0, pin::OUT, pin::NONE),
-		      new gpio("P8_36", "lcd_data10",  2, 16, pin_fct::lcd_data10     , pin_fct::gpmc_a14       , pin_fct::ehrpwm1A       , pin_fct::mcasp0_axr0    , pin_fct::mcasp0_axr0    , NULL                    , pin_fct::uart3_ctsn     , pin_fct::gpio2_16       ,0, pin::OUT, pin::NONE),
-		      new gpio("P8_37", "lcd_data8" ,  2, 14, pin_fct::lcd_data8      , pin_fct::gpmc_a12       , NULL                    , pin_fct::mcasp0_aclkx   , NULL                    , NULL                    , pin_fct::uart2_ctsn     , pin_fct::gpio2_14       ,0, pin::OUT, pin::NONE),
-		      new gpio("P8_38", "lcd_data9" ,  2, 15, pin_fct::lcd_data9      , pin_fct::gpmc_a13       , NULL                    , pin_fct::mcasp0_fsx     , NULL                    , NULL                    , pin_fct::uart2_rtsn     , pin_fct::gpio2_15       ,0, pin::OUT, pin::NONE),
-		      new gpio("P8_39", "lcd_data6" ,  2, 12, pin_fct::lcd_data6      , pin_fct::gpmc_a6        , NULL                    , pin_fct::eqep2_index    , NULL                    , NULL                    , NULL                    , pin_fct::gpio2_12       ,0, pin::OUT, pin::NONE),
-		      new gpio("P8_40", "lcd_data7" ,  2, 13, pin_fct::lcd_data7      , pin_fct::gpmc_a7        , NULL                    , pin_fct::eqep2_strobe   , NULL                    , NULL                    , NULL                    , pin_fct::gpio2_13       ,0, pin::OUT, pin::NONE),
-		      new gpio("P8_41", "lcd_data4" ,  2, 10, pin_fct::lcd_data4      , pin_fct::gpmc_a4        , NULL                    , pin_fct::eQEP2A_in      , NULL                    , NULL                    , NULL                    , pin_fct::gpio2_10       ,0, pin::OUT, pin::NONE),
-		      new gpio("P8_42", "lcd_data5" ,  2, 11, pin_fct::lcd_data5      , pin_fct::gpmc_a5        , NULL                    , pin_fct::eqep2b_in      , NULL                    , NULL                    , NULL                    , pin_fct::gpio2_11       ,0, pin::OUT, pin::NONE),
-		      new gpio("P8_43", "lcd_data2" ,  2, 8 , pin_fct::lcd_data2      , pin_fct::gpmc_a2        , NULL                    , pin_fct::ehrpwm2_tripzone_input , NULL                    , NULL                    , NULL                    , pin_fct::gpio2_8        ,0, pin::OUT, pin::NONE),
-		      new gpio("P8_44", "lcd_data3" ,  2, 9 , pin_fct::lcd_data3      , pin_fct::gpmc_a3        , NULL                    , pin_fct::ehrpwm0_synco  , NULL                    , NULL                    , NULL                    , pin_fct::gpio2_9        ,0, pin::OUT, pin::NONE),
-		      new gpio("P8_45", "lcd_data0" ,  2, 6 , pin_fct::lcd_data0      , pin_fct::gpmc_a0        , NULL                    , pin_fct::ehrpwm2A       , NULL                    , NULL                    , NULL                    , pin_fct::gpio2_6        ,0, pin::OUT, pin::NONE),
-		      new gpio("P8_46", "lcd_data1" ,  2, 7 , pin_fct::lcd_data1      , pin_fct::gpmc_a1        , NULL                    , pin_fct::ehrpwm2B       , NULL                    , NULL                    , NULL                    , pin_fct::gpio2_7        ,0, pin::OUT, pin::NONE)};
-
-pin* pin::m_P9[46] = {new unmuxed_pin("P9_1", &GND, pin::OUT, pin::NONE),
-		      new unmuxed_pin("P9_2", &GND, pin::OUT, pin::NONE),
-		      new unmuxed_pin("P9_3", &VDD_3V3EXP, pin::OUT, pin::NONE),
-		      new unmuxed_pin("P9_4", &VDD_3V3EXP, pin::OUT, pin::NONE),
-		      new unmuxed_pin("P9_5", &VDD_5V, pin::OUT, pin::NONE),
-		      new unmuxed_pin("P9_6", &VDD_5V, pin::OUT, pin::NONE),
-		      new unmuxed_pin("P9_7", &SYS_5V, pin::OUT, pin::NONE),
-		      new unmuxed_pin("P9_8", &SYS_5V, pin::OUT, pin::NONE),
-		      new unmuxed_pin("P9_9", &PWR_BUT, pin::OUT, pin::NONE),
-		      new unmuxed_pin("P9_10", &SYS_RESETn, pin::OUT, pin::NONE),
-		      new gpio("P9_11", "gpmc_wait0",  0, 30, pin_fct::gpmc_wait0     , pin_fct::mii2_crs       , NULL                    , pin_fct::rmii2_crs_dv   , pin_fct::mmc1_sdcd      , NULL                    , NULL                    , pin_fct::gpio0_30       ,0, pin::IN, pin::NONE),
-		      new gpio("P9_12", "gpmc_ben1" ,  1, 28, pin_fct::gpmc_ben1      , pin_fct::mii2_col       , NULL                    , pin_fct::mmc2_dat3      , NULL                    , NULL                    , pin_fct::mcasp0_aclkr   , pin_fct::gpio1_28       ,7, pin::IN, pin::NONE),
-		      new gpio("P9_13", "gpmc_wpn"  ,  0, 31, pin_fct::gpmc_wpn       , pin_fct::mii2_rxerr     , NULL                    , pin_fct::rmii2_rxerr    , pin_fct::mmc2_sdcd      , NULL                    , NULL                    , pin_fct::gpio0_31       ,7, pin::IN, pin::NONE),
-		      new gpio("P9_14", "gpmc_a2"   ,  1, 18, pin_fct::gpmc_a2        , pin_fct::gmii2_txd3     , pin_fct::rgmii2_td3     , pin_fct::mmc2_dat1      , pin_fct::gpmc_a18       , NULL                    , pin_fct::ehrpwm1A       , pin_fct::gpio1_18       ,7, pin::IN, pin::NONE),
-		      new gpio("P9_15", "gpmc_a0"   ,  1, 16, pin_fct::gpmc_a0        , pin_fct::gmii2_txen     , pin_fct::rgmii2_tctl    , pin_fct::rmii2_txen     , pin_fct::gpmc_a16       , NULL                    , pin_fct::ehrpwm1_tripzone_input , pin_fct::gpio1_16       ,7, pin::IN, pin::NONE),
-		      new gpio("P9_16", "gpmc_a3"   ,  1, 19, pin_fct::gpmc_a3        , pin_fct::gmii2_txd2     , pin_fct::rgmii2_td2     , pin_fct::mmc2_dat2      , pin_fct::gpmc_a19       , NULL                    , pin_fct::ehrpwm1B       , pin_fct::gpio1_19       ,7, pin::IN, pin::NONE),
- /* ? */              new gpio("P9_17", "spi0_cs0"  ,  0, 5 , pin_fct::spi0_cs0       , pin_fct::mmc2_sdwp      , pin_fct::i2c1_scl       , NULL                    , NULL                    , NULL                    , NULL                    , pin_fct::gpio0_5        ,2, pin::IN, pin::NONE),
-		      new gpio("P9_18", "spi0_d1"   ,  0, 4 , pin_fct::spi0_d1        , pin_fct::mmc1_sdwp      , pin_fct::i2c1_sda       , NULL                    , NULL                    , NULL                    , NULL                    , pin_fct::gpio0_4        ,2, pin::IN, pin::NONE),
-		      new gpio("P9_19", "uart1_rtsn",  0, 13, pin_fct::uart1_rtsn     , NULL                    , pin_fct::d_can0_rx      , pin_fct::i2c2_scl       , pin_fct::spi1_cs1       , NULL                    , NULL                    , pin_fct::gpio0_13       ,3, pin::IN, pin::NONE),
-		      new gpio("P9_20", "uart1_ctsn",  0, 12, pin_fct::uart1_ctsn     , NULL                    , pin_fct::d_can0_tx      , pin_fct::i2c2_sda       , pin_fct::spi1_cs0       , NULL                    , NULL                    , pin_fct::gpio0_12       ,3, pin::IN, pin::NONE),
-		      new gpio("P9_21", "spi0_d0"   ,  0, 3 , pin_fct::spi0_d0        , pin_fct::uart2_txd      , pin_fct::i2c2_scl       , NULL                    , NULL                    , NULL                    , NULL                    , pin_fct::gpio0_3        ,7, pin::IN, pin::NONE),
-		      new gpio("P9_22", "spi0_sclk" ,  0, 2 , pin_fct::spi0_sclk      , pin_fct::uart2_rxd      , pin_fct::i2c2_sda       , NULL                    , NULL                    , NULL                    , NULL                    , pin_fct::gpio0_2        ,7, pin::IN, pin::NONE),
-		      new gpio("P9_23", "gpmc_a1"   ,  1, 17, pin_fct::gpmc_a1        , pin_fct::gmii2_rxdv     , pin_fct::rgmii2_rctl    , pin_fct::mmc2_dat0      , pin_fct::gpmc_a17       , NULL                    , pin_fct::ehrpwm0_synco  , pin_fct::gpio1_17       ,7, pin::IN, pin::NONE),
-		      new gpio("P9_24", "uart1_txd" ,  0, 15, pin_fct::uart1_txd      , pin_fct::mmc2_sdwp      , pin_fct::d_can1_rx      , pin_fct::i2c1_scl       , NULL                    , NULL                    , NULL                    , pin_fct::gpio0_15       ,7, pin::IN, pin::NONE),
-		      new gpio("P9_25", "mcasp0_ahclkx",  3, 21, pin_fct::mcasp0_ahclkx  , NULL                    , pin_fct::mcasp0_axr3    , pin_fct::mcasp1_axr1    , NULL                    , NULL                    , NULL                    , pin_fct::gpio3_21       ,7, pin::IN, pin::NONE),
-		      new gpio("P9_26", "uart1_rxd" ,  0, 14, pin_fct::uart1_rxd      , pin_fct::mmc1_sdwp      , pin_fct::d_can1_tx      , pin_fct::i2c1_sda       , NULL                    , NULL                    , NULL                    , pin_fct::gpio0_14       ,7, pin::IN, pin::NONE),
-		      new gpio("P9_27", "mcasp0_fsr",  3, 19, pin_fct::mcasp0_fsr     , NULL                    , pin_fct::mcasp0_axr3    , pin_fct::mcasp1_fsx     , NULL                    , NULL                    , NULL                    , pin_fct::gpio3_19       ,7, pin::IN, pin::NONE),
-		      new gpio("P9_28", "mcasp0_ahclkr",  3, 17, pin_fct::mcasp0_ahclkr  , NULL                    , pin_fct::mcasp0_axr2    , pin_fct::spi1_cs0       , pin_fct::ecap2_in_pwm2_out , NULL                    , NULL                    , pin_fct::gpio3_17       ,3, pin::IN, pin::NONE),
-		      new gpio("P9_29", "mcasp0_fsx",  3, 15, pin_fct::mcasp0_fsx     , pin_fct::ehrpwm0B       , NULL                    , pin_fct::spi1_d0        , pin_fct::mmc1_sdcd      , NULL                    , NULL                    , pin_fct::gpio3_15       ,3, pin::IN, pin::NONE),
-		      new gpio("P9_30", "mcasp0_axr0",  3, 16, pin_fct::mcasp0_axr0    , NULL                    , NULL                    , pin_fct::spi1_d1        , pin_fct::mmc2_sdcd      , NULL                    , NULL                    , pin_fct::gpio3_16       ,3, pin::IN, pin::NONE),
-		      new gpio("P9_31", "mcasp0_aclkx",  3, 14, pin_fct::mcasp0_aclkx   , pin_fct::ehrpwm0A       , NULL                    , pin_fct::spi1_sclk      , pin_fct::mmc0_sdcd      , NULL                    , NULL                    , pin_fct::gpio3_14       ,3, pin::IN, pin::NONE),
-		      new unmuxed_pin("P9_32", &VADC, pin::OUT, pin::NONE),
-		      new unmuxed_pin("P9_33", &AIN4, pin::OUT, pin::NONE),
-		      new unmuxed_pin("P9_34", &AGND, pin::OUT, pin::NONE),
-		      new unmuxed_pin("P9_35", &AIN6, pin::OUT, pin::NONE),
-		      new unmuxed_pin("P9_36", &AIN5, pin::OUT, pin::NONE),
-		      new unmuxed_pin("P9_37", &AIN2, pin::OUT, pin::NONE),
-		      new unmuxed_pin("P9_38", &AIN3, pin::OUT, pin::NONE),
-		      new unmuxed_pin("P9_39", &AIN0, pin::OUT, pin::NONE),
-		      new unmuxed_pin("P9_40", &AIN1, pin::OUT, pin::NONE),
-		      new gpio("P9_41", "xdma_event_intr1",  0, 20, pin_fct::xdma_event_intr1 , NULL                    , NULL                    , pin_fct::clkout2        , NULL                    , NULL                    , NULL                    , pin_fct::gpio0_20       ,3, pin::OUT, pin::NONE),
-		      new gpio("P9_42", "ecap0_in_pwm0_out",  0, 7 , pin_fct::ecap0_in_pwm0_out , pin_fct::uart3_txd      , pin_fct::spi1_cs1       , NULL                    , pin_fct::spi1_sclk      , pin_fct::mmc0_sdwp      , pin_fct::xdma_event_intr2 , pin_fct::gpio0_7        ,7, pin::IN, pin::NONE),
-		      new unmuxed_pin("P9_43", &GND, pin::OUT, pin::NONE),
-		      new unmuxed_pin("P9_44", &GND, pin::OUT, pin::NONE),
-		      new unmuxed_pin("P9_45", &GND, pin::OUT, pin::NONE),
-		      new unmuxed_pin("P9_46", &GND, pin::OUT, pin::NONE)};
-
-  pin::pin(const char*    name,
-	   const char*    dev,
-	   pin_fct* const mode0,
-	   pin_fct* const mode1,
-	   pin_fct* const mode2,
-	   pin_fct* const mode3,
-	   pin_fct* const mode4,
-	   pin_fct* const mode5,
-	   pin_fct* const mode6,
-	   pin_fct* const mode7,
-	   int            init,
-	   direction_t    dir,
-	   pull_t         pulls)
-    : m_name(name), m_fct(NULL), m_gpio(mode7), m_locker(NULL), m_key(0)
+  //
+  // Every pin and function is a static member of pin_table with a constant
+  // initializer: nothing is allocated or constructed when the library loads.
+  //
+struct pin_table
 {
-  m_dev = (char*) malloc(strlen(devdir)+32);
-  sprintf(m_dev, "%s/%s", devdir, dev);
-
-  // ToDo: Detect actual current mux setting
-  switch(init) {
-  case 0: m_fct = mode0; break;
-  case 1: m_fct = mode1; break;
-  case 2: m_fct = mode2; break;
-  case 3: m_fct = mode3; break;
-  case 4: m_fct = mode4; break;
-  case 5: m_fct = mode5; break;
-  case 6: m_fct = mode6; break;
-  case 7: m_fct = mode7; break;
-  }
-
-  if (m_fct == NULL) {
-    fprintf(stderr, "ERROR: Pin %s is initialized to NULL functionality.\n", get_name());
-    return;
-  }
-
-  m_fct->m_pin = this;
+  static pin_fct clkout2;
+  static pin_fct d_can0_rx;
+  static pin_fct d_can0_tx;
+  static pin_fct d_can1_rx;
+  static pin_fct d_can1_tx;
+  static pin_fct eQEP2A_in;
+  static pin_fct ecap0_in_pwm0_out;
+  static pin_fct ecap2_in_pwm2_out;
+  static pin_fct ehrpwm0A;
+  static pin_fct ehrpwm0B;
+  static pin_fct ehrpwm0_synco;
+  static pin_fct ehrpwm1A;
+  static pin_fct ehrpwm1B;
+  static pin_fct ehrpwm1_tripzone_input;
+  static pin_fct ehrpwm2A;
+  static pin_fct ehrpwm2B;
+  static pin_fct ehrpwm2_tripzone_input;
+  static pin_fct eqep2B_in;
+  static pin_fct eqep2_index;
+  static pin_fct eqep2_strobe;
+  static pin_fct eqep2a_in;
+  static pin_fct eqep2b_in;
+  static pin_fct gmii2_rxdv;
+  static pin_fct gmii2_txd2;
+  static pin_fct gmii2_txd3;
+  static pin_fct gmii2_txen;
+  static pin_fct gpio0_10;
+  static pin_fct gpio0_11;
+  static pin_fct gpio0_12;
+  static pin_fct gpio0_13;
+  static pin_fct gpio0_14;
+  static pin_fct gpio0_15;
+  static pin_fct gpio0_2;
+  static pin_fct gpio0_20;
+  static pin_fct gpio0_22;
+  static pin_fct gpio0_23;
+  static pin_fct gpio0_26;
+  static pin_fct gpio0_27;
+  static pin_fct gpio0_3;
+  static pin_fct gpio0_30;
+  static pin_fct gpio0_31;
+  static pin_fct gpio0_4;
+  static pin_fct gpio0_5;
+  static pin_fct gpio0_7;
+  static pin_fct gpio0_8;
+  static pin_fct gpio0_9;
+  static pin_fct gpio1_0;
+  static pin_fct gpio1_1;
+  static pin_fct gpio1_12;
+  static pin_fct gpio1_13;
+  static pin_fct gpio1_14;
+  static pin_fct gpio1_15;
+  static pin_fct gpio1_16;
+  static pin_fct gpio1_17;
+  static pin_fct gpio1_18;
+  static pin_fct gpio1_19;
+  static pin_fct gpio1_2;
+  static pin_fct gpio1_28;
+  static pin_fct gpio1_29;
+  static pin_fct gpio1_3;
+  static pin_fct gpio1_30;
+  static pin_fct gpio1_31;
+  static pin_fct gpio1_4;
+  static pin_fct gpio1_5;
+  static pin_fct gpio1_6;
+  static pin_fct gpio1_7;
+  static pin_fct gpio2_1;
+  static pin_fct gpio2_10;
+  static pin_fct gpio2_11;
+  static pin_fct gpio2_12;
+  static pin_fct gpio2_13;
+  static pin_fct gpio2_14;
+  static pin_fct gpio2_15;
+  static pin_fct gpio2_16;
+  static pin_fct gpio2_17;
+  static pin_fct gpio2_22;
+  static pin_fct gpio2_23;
+  static pin_fct gpio2_24;
+  static pin_fct gpio2_25;
+  static pin_fct gpio2_3;
+  static pin_fct gpio2_4;
+  static pin_fct gpio2_5;
+  static pin_fct gpio2_6;
+  static pin_fct gpio2_7;
+  static pin_fct gpio2_8;
+  static pin_fct gpio2_9;
+  static pin_fct gpio3_14;
+  static pin_fct gpio3_15;
+  static pin_fct gpio3_16;
+  static pin_fct gpio3_17;
+  static pin_fct gpio3_19;
+  static pin_fct gpio3_21;
+  static pin_fct gpmc_a0;
+  static pin_fct gpmc_a1;
+  static pin_fct gpmc_a10;
+  static pin_fct gpmc_a11;
+  static pin_fct gpmc_a12;
+  static pin_fct gpmc_a13;
+  static pin_fct gpmc_a14;
+  static pin_fct gpmc_a15;
+  static pin_fct gpmc_a16;
+  static pin_fct gpmc_a17;
+  static pin_fct gpmc_a18;
+  static pin_fct gpmc_a19;
+  static pin_fct gpmc_a2;
+  static pin_fct gpmc_a3;
+  static pin_fct gpmc_a4;
+  static pin_fct gpmc_a5;
+  static pin_fct gpmc_a6;
+  static pin_fct gpmc_a7;
+  static pin_fct gpmc_a8;
+  static pin_fct gpmc_a9;
+  static pin_fct gpmc_ad0;
+  static pin_fct gpmc_ad1;
+  static pin_fct gpmc_ad10;
+  static pin_fct gpmc_ad11;
+  static pin_fct gpmc_ad12;
+  static pin_fct gpmc_ad13;
+  static pin_fct gpmc_ad14;
+  static pin_fct gpmc_ad15;
+  static pin_fct gpmc_ad2;
+  static pin_fct gpmc_ad3;
+  static pin_fct gpmc_ad4;
+  static pin_fct gpmc_ad5;
+  static pin_fct gpmc_ad6;
+  static pin_fct gpmc_ad7;
+  static pin_fct gpmc_ad8;
+  static pin_fct gpmc_ad9;
+  static pin_fct gpmc_advn_ale;
+  static pin_fct gpmc_be1n;
+  static pin_fct gpmc_ben0_cle;
+  static pin_fct gpmc_ben1;
+  static pin_fct gpmc_clk;
+  static pin_fct gpmc_csn0;
+  static pin_fct gpmc_csn1;
+  static pin_fct gpmc_csn2;
+  static pin_fct gpmc_oen_ren;
+  static pin_fct gpmc_wait0;
+  static pin_fct gpmc_wen;
+  static pin_fct gpmc_wpn;
+  static pin_fct i2c1_scl;
+  static pin_fct i2c1_sda;
+  static pin_fct i2c2_scl;
+  static pin_fct i2c2_sda;
+  static pin_fct lcd_ac_bias_en;
+  static pin_fct lcd_data0;
+  static pin_fct lcd_data1;
+  static pin_fct lcd_data10;
+  static pin_fct lcd_data11;
+  static pin_fct lcd_data12;
+  static pin_fct lcd_data13;
+  static pin_fct lcd_data14;
+  static pin_fct lcd_data15;
+  static pin_fct lcd_data16;
+  static pin_fct lcd_data17;
+  static pin_fct lcd_data18;
+  static pin_fct lcd_data19;
+  static pin_fct lcd_data2;
+  static pin_fct lcd_data20;
+  static pin_fct lcd_data21;
+  static pin_fct lcd_data22;
+  static pin_fct lcd_data23;
+  static pin_fct lcd_data3;
+  static pin_fct lcd_data4;
+  static pin_fct lcd_data5;
+  static pin_fct lcd_data6;
+  static pin_fct lcd_data7;
+  static pin_fct lcd_data8;
+  static pin_fct lcd_data9;
+  static pin_fct lcd_hsync;
+  static pin_fct lcd_memory_clk_mux;
+  static pin_fct lcd_pclk;
+  static pin_fct lcd_vsync;
+  static pin_fct mcasp0_aclkr;
+  static pin_fct mcasp0_aclkx;
+  static pin_fct mcasp0_ahclkr;
+  static pin_fct mcasp0_ahclkx;
+  static pin_fct mcasp0_axr0;
+  static pin_fct mcasp0_axr1;
+  static pin_fct mcasp0_axr2;
+  static pin_fct mcasp0_axr3;
+  static pin_fct mcasp0_fsr;
+  static pin_fct mcasp0_fsx;
+  static pin_fct mcasp1_axr1;
+  static pin_fct mcasp1_fsx;
+  static pin_fct mii2_col;
+  static pin_fct mii2_crs;
+  static pin_fct mii2_rxerr;
+  static pin_fct mmc0_sdcd;
+  static pin_fct mmc0_sdwp;
+  static pin_fct mmc1_clk;
+  static pin_fct mmc1_cmd;
+  static pin_fct mmc1_dat0;
+  static pin_fct mmc1_dat1;
+  static pin_fct mmc1_dat2;
+  static pin_fct mmc1_dat3;
+  static pin_fct mmc1_dat4;
+  static pin_fct mmc1_dat5;
+  static pin_fct mmc1_dat6;
+  static pin_fct mmc1_dat7;
+  static pin_fct mmc1_sdcd;
+  static pin_fct mmc1_sdwp;
+  static pin_fct mmc2_clk;
+  static pin_fct mmc2_dat0;
+  static pin_fct mmc2_dat1;
+  static pin_fct mmc2_dat2;
+  static pin_fct mmc2_dat3;
+  static pin_fct mmc2_dat4;
+  static pin_fct mmc2_dat5;
+  static pin_fct mmc2_dat6;
+  static pin_fct mmc2_dat7;
+  static pin_fct mmc2_sdcd;
+  static pin_fct mmc2_sdwp;
+  static pin_fct rgmii2_rctl;
+  static pin_fct rgmii2_tctl;
+  static pin_fct rgmii2_td2;
+  static pin_fct rgmii2_td3;
+  static pin_fct rmii2_crs_dv;
+  static pin_fct rmii2_rxerr;
+  static pin_fct rmii2_txen;
+  static pin_fct spi0_cs0;
+  static pin_fct spi0_d0;
+  static pin_fct spi0_d1;
+  static pin_fct spi0_sclk;
+  static pin_fct spi1_cs0;
+  static pin_fct spi1_cs1;
+  static pin_fct spi1_d0;
+  static pin_fct spi1_d1;
+  static pin_fct spi1_sclk;
+  static pin_fct uart1_ctsn;
+  static pin_fct uart1_rtsn;
+  static pin_fct uart1_rxd;
+  static pin_fct uart1_txd;
+  static pin_fct uart2_ctsn;
+  static pin_fct uart2_rtsn;
+  static pin_fct uart2_rxd;
+  static pin_fct uart2_txd;
+  static pin_fct uart3_ctsn;
+  static pin_fct uart3_txd;
+  static pin_fct xdma_event_intr1;
+  static pin_fct xdma_event_intr2;
+
+  static unmuxed_pin P8_1;
+  static unmuxed_pin P8_2;
+  static gpio        P8_3;
+  static gpio        P8_4;
+  static gpio        P8_5;
+  static gpio        P8_6;
+  static pin         P8_7;
+  static gpio        P8_8;
+  static gpio        P8_9;
+  static gpio        P8_10;
+  static gpio        P8_11;
+  static gpio        P8_12;
+  static gpio        P8_13;
+  static gpio        P8_14;
+  static gpio        P8_15;
+  static gpio        P8_16;
+  static gpio        P8_17;
+  static gpio        P8_18;
+  static gpio        P8_19;
+  static gpio        P8_20;
+  static gpio        P8_21;
+  static gpio        P8_22;
+  static gpio        P8_23;
+  static gpio        P8_24;
+  static gpio        P8_25;
+  static gpio        P8_26;
+  static gpio        P8_27;
+  static gpio        P8_28;
+  static gpio        P8_29;
+  static gpio        P8_30;
+  static gpio        P8_31;
+  static gpio        P8_32;
+  static gpio        P8_33;
+  static gpio        P8_34;
+  static gpio        P8_35;
+  static gpio        P8_36;
+  static gpio        P8_37;
+  static gpio        P8_38;
+  static gpio        P8_39;
+  static gpio        P8_40;
+  static gpio        P8_41;
+  static gpio        P8_42;
+  static gpio        P8_43;
+  static gpio        P8_44;
+  static gpio        P8_45;
+  static gpio        P8_46;
+  static unmuxed_pin P9_1;
+  static unmuxed_pin P9_2;
+  static unmuxed_pin P9_3;
+  static unmuxed_pin P9_4;
+  static unmuxed_pin P9_5;
+  static unmuxed_pin P9_6;
+  static unmuxed_pin P9_7;
+  static unmuxed_pin P9_8;
+  static unmuxed_pin P9_9;
+  static unmuxed_pin P9_10;
+  static gpio        P9_11;
+  static gpio        P9_12;
+  static gpio        P9_13;
+  static gpio        P9_14;
+  static gpio        P9_15;
+  static gpio        P9_16;
+  static gpio        P9_17;
+  static gpio        P9_18;
+  static gpio        P9_19;
+  static gpio        P9_20;
+  static gpio        P9_21;
+  static gpio        P9_22;
+  static gpio        P9_23;
+  static gpio        P9_24;
+  static gpio        P9_25;
+  static gpio        P9_26;
+  static gpio        P9_27;
+  static gpio        P9_28;
+  static gpio        P9_29;
+  static gpio        P9_30;
+  static gpio        P9_31;
+  static unmuxed_pin P9_32;
+  static unmuxed_pin P9_33;
+  static unmuxed_pin P9_34;
+  static unmuxed_pin P9_35;
+  static unmuxed_pin P9_36;
+  static unmuxed_pin P9_37;
+  static unmuxed_pin P9_38;
+  static unmuxed_pin P9_39;
+  static unmuxed_pin P9_40;
+  static gpio        P9_41;
+  static gpio        P9_42;
+  static unmuxed_pin P9_43;
+  static unmuxed_pin P9_44;
+  static unmuxed_pin P9_45;
+  static unmuxed_pin P9_46;
+};
 
-  m_pin_can_do(mode0, 0);
-  m_pin_can_do(mode1, 1);
-  m_pin_can_do(mode2, 2);
-  m_pin_can_do(mode3, 3);
-  m_pin_can_do(mode4, 4);
-  m_pin_can_do(mode5, 5);
-  m_pin_can_do(mode6, 6);
-  m_pin_can_do(mode7, 7);
-}
 
-void
-pin::m_pin_can_do(pin_fct* const fct, unsigned char mode)
-{
-  int i = 0;
-  if (fct == NULL) return;
-
-  pin** p = fct->m_pins;
-  while (*p) {
-    p++;
-    i++;
-  }
-  fct->m_pins[i] = this;
-  fct->m_mode[i] = mode;
-}
+pin_fct pin_table::clkout2("clkout2");
+pin_fct pin_table::d_can0_rx("d_can0_rx");
+pin_fct pin_table::d_can0_tx("d_can0_tx");
+pin_fct pin_table::d_can1_rx("d_can1_rx");
+pin_fct pin_table::d_can1_tx("d_can1_tx");
+pin_fct pin_table::eQEP2A_in("eQEP2A_in");
+pin_fct pin_table::ecap0_in_pwm0_out("ecap0_in_pwm0_out");
+pin_fct pin_table::ecap2_in_pwm2_out("ecap2_in_pwm2_out");
+pin_fct pin_table::ehrpwm0A("ehrpwm0A");
+pin_fct pin_table::ehrpwm0B("ehrpwm0B");
+pin_fct pin_table::ehrpwm0_synco("ehrpwm0_synco");
+pin_fct pin_table::ehrpwm1A("ehrpwm1A");
+pin_fct pin_table::ehrpwm1B("ehrpwm1B");
+pin_fct pin_table::ehrpwm1_tripzone_input("ehrpwm1_tripzone_input");
+pin_fct pin_table::ehrpwm2A("ehrpwm2A");
+pin_fct pin_table::ehrpwm2B("ehrpwm2B");
+pin_fct pin_table::ehrpwm2_tripzone_input("ehrpwm2_tripzone_input");
+pin_fct pin_table::eqep2B_in("eqep2B_in");
+pin_fct pin_table::eqep2_index("eqep2_index");
+pin_fct pin_table::eqep2_strobe("eqep2_strobe");
+pin_fct pin_table::eqep2a_in("eqep2a_in");
+pin_fct pin_table::eqep2b_in("eqep2b_in");
+pin_fct pin_table::gmii2_rxdv("gmii2_rxdv");
+pin_fct pin_table::gmii2_txd2("gmii2_txd2");
+pin_fct pin_table::gmii2_txd3("gmii2_txd3");
+pin_fct pin_table::gmii2_txen("gmii2_txen");
+pin_fct pin_table::gpio0_10("gpio0_10");
+pin_fct pin_table::gpio0_11("gpio0_11");
+pin_fct pin_table::gpio0_12("gpio0_12");
+pin_fct pin_table::gpio0_13("gpio0_13");
+pin_fct pin_table::gpio0_14("gpio0_14");
+pin_fct pin_table::gpio0_15("gpio0_15");
+pin_fct pin_table::gpio0_2("gpio0_2");
+pin_fct pin_table::gpio0_20("gpio0_20");
+pin_fct pin_table::gpio0_22("gpio0_22");
+pin_fct pin_table::gpio0_23("gpio0_23");
+pin_fct pin_table::gpio0_26("gpio0_26");
+pin_fct pin_table::gpio0_27("gpio0_27");
+pin_fct pin_table::gpio0_3("gpio0_3");
+pin_fct pin_table::gpio0_30("gpio0_30");
+pin_fct pin_table::gpio0_31("gpio0_31");
+pin_fct pin_table::gpio0_4("gpio0_4");
+pin_fct pin_table::gpio0_5("gpio0_5");
+pin_fct pin_table::gpio0_7("gpio0_7");
+pin_fct pin_table::gpio0_8("gpio0_8");
+pin_fct pin_table::gpio0_9("gpio0_9");
+pin_fct pin_table::gpio1_0("gpio1_0");
+pin_fct pin_table::gpio1_1("gpio1_1");
+pin_fct pin_table::gpio1_12("gpio1_12");
+pin_fct pin_table::gpio1_13("gpio1_13");
+pin_fct pin_table::gpio1_14("gpio1_14");
+pin_fct pin_table::gpio1_15("gpio1_15");
+pin_fct pin_table::gpio1_16("gpio1_16");
+pin_fct pin_table::gpio1_17("gpio1_17");
+pin_fct pin_table::gpio1_18("gpio1_18");
+pin_fct pin_table::gpio1_19("gpio1_19");
+pin_fct pin_table::gpio1_2("gpio1_2");
+pin_fct pin_table::gpio1_28("gpio1_28");
+pin_fct pin_table::gpio1_29("gpio1_29");
+pin_fct pin_table::gpio1_3("gpio1_3");
+pin_fct pin_table::gpio1_30("gpio1_30");
+pin_fct pin_table::gpio1_31("gpio1_31");
+pin_fct pin_table::gpio1_4("gpio1_4");
+pin_fct pin_table::gpio1_5("gpio1_5");
+pin_fct pin_table::gpio1_6("gpio1_6");
+pin_fct pin_table::gpio1_7("gpio1_7");
+pin_fct pin_table::gpio2_1("gpio2_1");
+pin_fct pin_table::gpio2_10("gpio2_10");
+pin_fct pin_table::gpio2_11("gpio2_11");
+pin_fct pin_table::gpio2_12("gpio2_12");
+pin_fct pin_table::gpio2_13("gpio2_13");
+pin_fct pin_table::gpio2_14("gpio2_14");
+pin_fct pin_table::gpio2_15("gpio2_15");
+pin_fct pin_table::gpio2_16("gpio2_16");
+pin_fct pin_table::gpio2_17("gpio2_17");
+pin_fct pin_table::gpio2_22("gpio2_22");
+pin_fct pin_table::gpio2_23("gpio2_23");
+pin_fct pin_table::gpio2_24("gpio2_24");
+pin_fct pin_table::gpio2_25("gpio2_25");
+pin_fct pin_table::gpio2_3("gpio2_3");
+pin_fct pin_table::gpio2_4("gpio2_4");
+pin_fct pin_table::gpio2_5("gpio2_5");
+pin_fct pin_table::gpio2_6("gpio2_6");
+pin_fct pin_table::gpio2_7("gpio2_7");
+pin_fct pin_table::gpio2_8("gpio2_8");
+pin_fct pin_table::gpio2_9("gpio2_9");
+pin_fct pin_table::gpio3_14("gpio3_14");
+pin_fct pin_table::gpio3_15("gpio3_15");
+pin_fct pin_table::gpio3_16("gpio3_16");
+pin_fct pin_table::gpio3_17("gpio3_17");
+pin_fct pin_table::gpio3_19("gpio3_19");
+pin_fct pin_table::gpio3_21("gpio3_21");
+pin_fct pin_table::gpmc_a0("gpmc_a0");
+pin_fct pin_table::gpmc_a1("gpmc_a1");
+pin_fct pin_table::gpmc_a10("gpmc_a10");
+pin_fct pin_table::gpmc_a11("gpmc_a11");
+pin_fct pin_table::gpmc_a12("gpmc_a12");
+pin_fct pin_table::gpmc_a13("gpmc_a13");
+pin_fct pin_table::gpmc_a14("gpmc_a14");
+pin_fct pin_table::gpmc_a15("gpmc_a15");
+pin_fct pin_table::gpmc_a16("gpmc_a16");
+pin_fct pin_table::gpmc_a17("gpmc_a17");
+pin_fct pin_table::gpmc_a18("gpmc_a18");
+pin_fct pin_table::gpmc_a19("gpmc_a19");
+pin_fct pin_table::gpmc_a2("gpmc_a2");
+pin_fct pin_table::gpmc_a3("gpmc_a3");
+pin_fct pin_table::gpmc_a4("gpmc_a4");
+pin_fct pin_table::gpmc_a5("gpmc_a5");
+pin_fct pin_table::gpmc_a6("gpmc_a6");
+pin_fct pin_table::gpmc_a7("gpmc_a7");
+pin_fct pin_table::gpmc_a8("gpmc_a8");
+pin_fct pin_table::gpmc_a9("gpmc_a9");
+pin_fct pin_table::gpmc_ad0("gpmc_ad0");
+pin_fct pin_table::gpmc_ad1("gpmc_ad1");
+pin_fct pin_table::gpmc_ad10("gpmc_ad10");
+pin_fct pin_table::gpmc_ad11("gpmc_ad11");
+pin_fct pin_table::gpmc_ad12("gpmc_ad12");
+pin_fct pin_table::gpmc_ad13("gpmc_ad13");
+pin_fct pin_table::gpmc_ad14("gpmc_ad14");
+pin_fct pin_table::gpmc_ad15("gpmc_ad15");
+pin_fct pin_table::gpmc_ad2("gpmc_ad2");
+pin_fct pin_table::gpmc_ad3("gpmc_ad3");
+pin_fct pin_table::gpmc_ad4("gpmc_ad4");
+pin_fct pin_table::gpmc_ad5("gpmc_ad5");
+pin_fct pin_table::gpmc_ad6("gpmc_ad6");
+pin_fct pin_table::gpmc_ad7("gpmc_ad7");
+pin_fct pin_table::gpmc_ad8("gpmc_ad8");
+pin_fct pin_table::gpmc_ad9("gpmc_ad9");
+pin_fct pin_table::gpmc_advn_ale("gpmc_advn_ale");
+pin_fct pin_table::gpmc_be1n("gpmc_be1n");
+pin_fct pin_table::gpmc_ben0_cle("gpmc_ben0_cle");
+pin_fct pin_table::gpmc_ben1("gpmc_ben1");
+pin_fct pin_table::gpmc_clk("gpmc_clk");
+pin_fct pin_table::gpmc_csn0("gpmc_csn0");
+pin_fct pin_table::gpmc_csn1("gpmc_csn1");
+pin_fct pin_table::gpmc_csn2("gpmc_csn2");
+pin_fct pin_table::gpmc_oen_ren("gpmc_oen_ren");
+pin_fct pin_table::gpmc_wait0("gpmc_wait0");
+pin_fct pin_table::gpmc_wen("gpmc_wen");
+pin_fct pin_table::gpmc_wpn("gpmc_wpn");
+pin_fct pin_table::i2c1_scl("i2c1_scl");
+pin_fct pin_table::i2c1_sda("i2c1_sda");
+pin_fct pin_table::i2c2_scl("i2c2_scl");
+pin_fct pin_table::i2c2_sda("i2c2_sda");
+pin_fct pin_table::lcd_ac_bias_en("lcd_ac_bias_en");
+pin_fct pin_table::lcd_data0("lcd_data0");
+pin_fct pin_table::lcd_data1("lcd_data1");
+pin_fct pin_table::lcd_data10("lcd_data10");
+pin_fct pin_table::lcd_data11("lcd_data11");
+pin_fct pin_table::lcd_data12("lcd_data12");
+pin_fct pin_table::lcd_data13("lcd_data13");
+pin_fct pin_table::lcd_data14("lcd_data14");
+pin_fct pin_table::lcd_data15("lcd_data15");
+pin_fct pin_table::lcd_data16("lcd_data16");
+pin_fct pin_table::lcd_data17("lcd_data17");
+pin_fct pin_table::lcd_data18("lcd_data18");
+pin_fct pin_table::lcd_data19("lcd_data19");
+pin_fct pin_table::lcd_data2("lcd_data2");
+pin_fct pin_table::lcd_data20("lcd_data20");
+pin_fct pin_table::lcd_data21("lcd_data21");
+pin_fct pin_table::lcd_data22("lcd_data22");
+pin_fct pin_table::lcd_data23("lcd_data23");
+pin_fct pin_table::lcd_data3("lcd_data3");
+pin_fct pin_table::lcd_data4("lcd_data4");
+pin_fct pin_table::lcd_data5("lcd_data5");
+pin_fct pin_table::lcd_data6("lcd_data6");
+pin_fct pin_table::lcd_data7("lcd_data7");
+pin_fct pin_table::lcd_data8("lcd_data8");
+pin_fct pin_table::lcd_data9("lcd_data9");
+pin_fct pin_table::lcd_hsync("lcd_hsync");
+pin_fct pin_table::lcd_memory_clk_mux("lcd_memory_clk_mux");
+pin_fct pin_table::lcd_pclk("lcd_pclk");
+pin_fct pin_table::lcd_vsync("lcd_vsync");
+pin_fct pin_table::mcasp0_aclkr("mcasp0_aclkr");
+pin_fct pin_table::mcasp0_aclkx("mcasp0_aclkx");
+pin_fct pin_table::mcasp0_ahclkr("mcasp0_ahclkr");
+pin_fct pin_table::mcasp0_ahclkx("mcasp0_ahclkx");
+pin_fct pin_table::mcasp0_axr0("mcasp0_axr0");
+pin_fct pin_table::mcasp0_axr1("mcasp0_axr1");
+pin_fct pin_table::mcasp0_axr2("mcasp0_axr2");
+pin_fct pin_table::mcasp0_axr3("mcasp0_axr3");
+pin_fct pin_table::mcasp0_fsr("mcasp0_fsr");
+pin_fct pin_table::mcasp0_fsx("mcasp0_fsx");
+pin_fct pin_table::mcasp1_axr1("mcasp1_axr1");
+pin_fct pin_table::mcasp1_fsx("mcasp1_fsx");
+pin_fct pin_table::mii2_col("mii2_col");
+pin_fct pin_table::mii2_crs("mii2_crs");
+pin_fct pin_table::mii2_rxerr("mii2_rxerr");
+pin_fct pin_table::mmc0_sdcd("mmc0_sdcd");
+pin_fct pin_table::mmc0_sdwp("mmc0_sdwp");
+pin_fct pin_table::mmc1_clk("mmc1_clk");
+pin_fct pin_table::mmc1_cmd("mmc1_cmd");
+pin_fct pin_table::mmc1_dat0("mmc1_dat0");
+pin_fct pin_table::mmc1_dat1("mmc1_dat1");
+pin_fct pin_table::mmc1_dat2("mmc1_dat2");
+pin_fct pin_table::mmc1_dat3("mmc1_dat3");
+pin_fct pin_table::mmc1_dat4("mmc1_dat4");
+pin_fct pin_table::mmc1_dat5("mmc1_dat5");
+pin_fct pin_table::mmc1_dat6("mmc1_dat6");
+pin_fct pin_table::mmc1_dat7("mmc1_dat7");
+pin_fct pin_table::mmc1_sdcd("mmc1_sdcd");
+pin_fct pin_table::mmc1_sdwp("mmc1_sdwp");
+pin_fct pin_table::mmc2_clk("mmc2_clk");
+pin_fct pin_table::mmc2_dat0("mmc2_dat0");
+pin_fct pin_table::mmc2_dat1("mmc2_dat1");
+pin_fct pin_table::mmc2_dat2("mmc2_dat2");
+pin_fct pin_table::mmc2_dat3("mmc2_dat3");
+pin_fct pin_table::mmc2_dat4("mmc2_dat4");
+pin_fct pin_table::mmc2_dat5("mmc2_dat5");
+pin_fct pin_table::mmc2_dat6("mmc2_dat6");
+pin_fct pin_table::mmc2_dat7("mmc2_dat7");
+pin_fct pin_table::mmc2_sdcd("mmc2_sdcd");
+pin_fct pin_table::mmc2_sdwp("mmc2_sdwp");
+pin_fct pin_table::rgmii2_rctl("rgmii2_rctl");
+pin_fct pin_table::rgmii2_tctl("rgmii2_tctl");
+pin_fct pin_table::rgmii2_td2("rgmii2_td2");
+pin_fct pin_table::rgmii2_td3("rgmii2_td3");
+pin_fct pin_table::rmii2_crs_dv("rmii2_crs_dv");
+pin_fct pin_table::rmii2_rxerr("rmii2_rxerr");
+pin_fct pin_table::rmii2_txen("rmii2_txen");
+pin_fct pin_table::spi0_cs0("spi0_cs0");
+pin_fct pin_table::spi0_d0("spi0_d0");
+pin_fct pin_table::spi0_d1("spi0_d1");
+pin_fct pin_table::spi0_sclk("spi0_sclk");
+pin_fct pin_table::spi1_cs0("spi1_cs0");
+pin_fct pin_table::spi1_cs1("spi1_cs1");
+pin_fct pin_table::spi1_d0("spi1_d0");
+pin_fct pin_table::spi1_d1("spi1_d1");
+pin_fct pin_table::spi1_sclk("spi1_sclk");
+pin_fct pin_table::uart1_ctsn("uart1_ctsn");
+pin_fct pin_table::uart1_rtsn("uart1_rtsn");
+pin_fct pin_table::uart1_rxd("uart1_rxd");
+pin_fct pin_table::uart1_txd("uart1_txd");
+pin_fct pin_table::uart2_ctsn("uart2_ctsn");
+pin_fct pin_table::uart2_rtsn("uart2_rtsn");
+pin_fct pin_table::uart2_rxd("uart2_rxd");
+pin_fct pin_table::uart2_txd("uart2_txd");
+pin_fct pin_table::uart3_ctsn("uart3_ctsn");
+pin_fct pin_table::uart3_txd("uart3_txd");
+pin_fct pin_table::xdma_event_intr1("xdma_event_intr1");
+pin_fct pin_table::xdma_event_intr2("xdma_event_intr2");
+
+pin_fct* const pin_fct::clkout2                = &pin_table::clkout2;
+pin_fct* const pin_fct::d_can0_rx              = &pin_table::d_can0_rx;
+pin_fct* const pin_fct::d_can0_tx              = &pin_table::d_can0_tx;
+pin_fct* const pin_fct::d_can1_rx              = &pin_table::d_can1_rx;
+pin_fct* const pin_fct::d_can1_tx              = &pin_table::d_can1_tx;
+pin_fct* const pin_fct::eQEP2A_in              = &pin_table::eQEP2A_in;
+pin_fct* const pin_fct::ecap0_in_pwm0_out      = &pin_table::ecap0_in_pwm0_out;
+pin_fct* const pin_fct::ecap2_in_pwm2_out      = &pin_table::ecap2_in_pwm2_out;
+pin_fct* const pin_fct::ehrpwm0A               = &pin_table::ehrpwm0A;
+pin_fct* const pin_fct::ehrpwm0B               = &pin_table::ehrpwm0B;
+pin_fct* const pin_fct::ehrpwm0_synco          = &pin_table::ehrpwm0_synco;
+pin_fct* const pin_fct::ehrpwm1A               = &pin_table::ehrpwm1A;
+pin_fct* const pin_fct::ehrpwm1B               = &pin_table::ehrpwm1B;
+pin_fct* const pin_fct::ehrpwm1_tripzone_input = &pin_table::ehrpwm1_tripzone_input;
+pin_fct* const pin_fct::ehrpwm2A               = &pin_table::ehrpwm2A;
+pin_fct* const pin_fct::ehrpwm2B               = &pin_table::ehrpwm2B;
+pin_fct* const pin_fct::ehrpwm2_tripzone_input = &pin_table::ehrpwm2_tripzone_input;
+pin_fct* const pin_fct::eqep2B_in              = &pin_table::eqep2B_in;
+pin_fct* const pin_fct::eqep2_index            = &pin_table::eqep2_index;
+pin_fct* const pin_fct::eqep2_strobe           = &pin_table::eqep2_strobe;
+pin_fct* const pin_fct::eqep2a_in              = &pin_table::eqep2a_in;
+pin_fct* const pin_fct::eqep2b_in              = &pin_table::eqep2b_in;
+pin_fct* const pin_fct::gmii2_rxdv             = &pin_table::gmii2_rxdv;
+pin_fct* const pin_fct::gmii2_txd2             = &pin_table::gmii2_txd2;
+pin_fct* const pin_fct::gmii2_txd3             = &pin_table::gmii2_txd3;
+pin_fct* const pin_fct::gmii2_txen             = &pin_table::gmii2_txen;
+pin_fct* const pin_fct::gpio0_10               = &pin_table::gpio0_10;
+pin_fct* const pin_fct::gpio0_11               = &pin_table::gpio0_11;
+pin_fct* const pin_fct::gpio0_12               = &pin_table::gpio0_12;
+pin_fct* const pin_fct::gpio0_13               = &pin_table::gpio0_13;
+pin_fct* const pin_fct::gpio0_14               = &pin_table::gpio0_14;
+pin_fct* const pin_fct::gpio0_15               = &pin_table::gpio0_15;
+pin_fct* const pin_fct::gpio0_2                = &pin_table::gpio0_2;
+pin_fct* const pin_fct::gpio0_20               = &pin_table::gpio0_20;
+pin_fct* const pin_fct::gpio0_22               = &pin_table::gpio0_22;
+pin_fct* const pin_fct::gpio0_23               = &pin_table::gpio0_23;
+pin_fct* const pin_fct::gpio0_26               = &pin_table::gpio0_26;
+pin_fct* const pin_fct::gpio0_27               = &pin_table::gpio0_27;
+pin_fct* const pin_fct::gpio0_3                = &pin_table::gpio0_3;
+pin_fct* const pin_fct::gpio0_30               = &pin_table::gpio0_30;
+pin_fct* const pin_fct::gpio0_31               = &pin_table::gpio0_31;
+pin_fct* const pin_fct::gpio0_4                = &pin_table::gpio0_4;
+pin_fct* const pin_fct::gpio0_5                = &pin_table::gpio0_5;
+pin_fct* const pin_fct::gpio0_7                = &pin_table::gpio0_7;
+pin_fct* const pin_fct::gpio0_8                = &pin_table::gpio0_8;
+pin_fct* const pin_fct::gpio0_9                = &pin_table::gpio0_9;
+pin_fct* const pin_fct::gpio1_0                = &pin_table::gpio1_0;
+pin_fct* const pin_fct::gpio1_1                = &pin_table::gpio1_1;
+pin_fct* const pin_fct::gpio1_12               = &pin_table::gpio1_12;
+pin_fct* const pin_fct::gpio1_13               = &pin_table::gpio1_13;
+pin_fct* const pin_fct::gpio1_14               = &pin_table::gpio1_14;
+pin_fct* const pin_fct::gpio1_15               = &pin_table::gpio1_15;
+pin_fct* const pin_fct::gpio1_16               = &pin_table::gpio1_16;
+pin_fct* const pin_fct::gpio1_17               = &pin_table::gpio1_17;
+pin_fct* const pin_fct::gpio1_18               = &pin_table::gpio1_18;
+pin_fct* const pin_fct::gpio1_19               = &pin_table::gpio1_19;
+pin_fct* const pin_fct::gpio1_2                = &pin_table::gpio1_2;
+pin_fct* const pin_fct::gpio1_28               = &pin_table::gpio1_28;
+pin_fct* const pin_fct::gpio1_29               = &pin_table::gpio1_29;
+pin_fct* const pin_fct::gpio1_3                = &pin_table::gpio1_3;
+pin_fct* const pin_fct::gpio1_30               = &pin_table::gpio1_30;
+pin_fct* const pin_fct::gpio1_31               = &pin_table::gpio1_31;
+pin_fct* const pin_fct::gpio1_4                = &pin_table::gpio1_4;
+pin_fct* const pin_fct::gpio1_5                = &pin_table::gpio1_5;
+pin_fct* const pin_fct::gpio1_6                = &pin_table::gpio1_6;
+pin_fct* const pin_fct::gpio1_7                = &pin_table::gpio1_7;
+pin_fct* const pin_fct::gpio2_1                = &pin_table::gpio2_1;
+pin_fct* const pin_fct::gpio2_10               = &pin_table::gpio2_10;
+pin_fct* const pin_fct::gpio2_11               = &pin_table::gpio2_11;
+pin_fct* const pin_fct::gpio2_12               = &pin_table::gpio2_12;
+pin_fct* const pin_fct::gpio2_13               = &pin_table::gpio2_13;
+pin_fct* const pin_fct::gpio2_14               = &pin_table::gpio2_14;
+pin_fct* const pin_fct::gpio2_15               = &pin_table::gpio2_15;
+pin_fct* const pin_fct::gpio2_16               = &pin_table::gpio2_16;
+pin_fct* const pin_fct::gpio2_17               = &pin_table::gpio2_17;
+pin_fct* const pin_fct::gpio2_22               = &pin_table::gpio2_22;
+pin_fct* const pin_fct::gpio2_23               = &pin_table::gpio2_23;
+pin_fct* const pin_fct::gpio2_24               = &pin_table::gpio2_24;
+pin_fct* const pin_fct::gpio2_25               = &pin_table::gpio2_25;
+pin_fct* const pin_fct::gpio2_3                = &pin_table::gpio2_3;
+pin_fct* const pin_fct::gpio2_4                = &pin_table::gpio2_4;
+pin_fct* const pin_fct::gpio2_5                = &pin_table::gpio2_5;
+pin_fct* const pin_fct::gpio2_6                = &pin_table::gpio2_6;
+pin_fct* const pin_fct::gpio2_7                = &pin_table::gpio2_7;
+pin_fct* const pin_fct::gpio2_8                = &pin_table::gpio2_8;
+pin_fct* const pin_fct::gpio2_9                = &pin_table::gpio2_9;
+pin_fct* const pin_fct::gpio3_14               = &pin_table::gpio3_14;
+pin_fct* const pin_fct::gpio3_15               = &pin_table::gpio3_15;
+pin_fct* const pin_fct::gpio3_16               = &pin_table::gpio3_16;
+pin_fct* const pin_fct::gpio3_17               = &pin_table::gpio3_17;
+pin_fct* const pin_fct::gpio3_19               = &pin_table::gpio3_19;
+pin_fct* const pin_fct::gpio3_21               = &pin_table::gpio3_21;
+pin_fct* const pin_fct::gpmc_a0                = &pin_table::gpmc_a0;
+pin_fct* const pin_fct::gpmc_a1                = &pin_table::gpmc_a1;
+pin_fct* const pin_fct::gpmc_a10               = &pin_table::gpmc_a10;
+pin_fct* const pin_fct::gpmc_a11               = &pin_table::gpmc_a11;
+pin_fct* const pin_fct::gpmc_a12               = &pin_table::gpmc_a12;
+pin_fct* const pin_fct::gpmc_a13               = &pin_table::gpmc_a13;
+pin_fct* const pin_fct::gpmc_a14               = &pin_table::gpmc_a14;
+pin_fct* const pin_fct::gpmc_a15               = &pin_table::gpmc_a15;
+pin_fct* const pin_fct::gpmc_a16               = &pin_table::gpmc_a16;
+pin_fct* const pin_fct::gpmc_a17               = &pin_table::gpmc_a17;
+pin_fct* const pin_fct::gpmc_a18               = &pin_table::gpmc_a18;
+pin_fct* const pin_fct::gpmc_a19               = &pin_table::gpmc_a19;
+pin_fct* const pin_fct::gpmc_a2                = &pin_table::gpmc_a2;
+pin_fct* const pin_fct::gpmc_a3                = &pin_table::gpmc_a3;
+pin_fct* const pin_fct::gpmc_a4                = &pin_table::gpmc_a4;
+pin_fct* const pin_fct::gpmc_a5                = &pin_table::gpmc_a5;
+pin_fct* const pin_fct::gpmc_a6                = &pin_table::gpmc_a6;
+pin_fct* const pin_fct::gpmc_a7                = &pin_table::gpmc_a7;
+pin_fct* const pin_fct::gpmc_a8                = &pin_table::gpmc_a8;
+pin_fct* const pin_fct::gpmc_a9                = &pin_table::gpmc_a9;
+pin_fct* const pin_fct::gpmc_ad0               = &pin_table::gpmc_ad0;
+pin_fct* const pin_fct::gpmc_ad1               = &pin_table::gpmc_ad1;
+pin_fct* const pin_fct::gpmc_ad10              = &pin_table::gpmc_ad10;
+pin_fct* const pin_fct::gpmc_ad11              = &pin_table::gpmc_ad11;
+pin_fct* const pin_fct::gpmc_ad12              = &pin_table::gpmc_ad12;
+pin_fct* const pin_fct::gpmc_ad13              = &pin_table::gpmc_ad13;
+pin_fct* const pin_fct::gpmc_ad14              = &pin_table::gpmc_ad14;
+pin_fct* const pin_fct::gpmc_ad15              = &pin_table::gpmc_ad15;
+pin_fct* const pin_fct::gpmc_ad2               = &pin_table::gpmc_ad2;
+pin_fct* const pin_fct::gpmc_ad3               = &pin_table::gpmc_ad3;
+pin_fct* const pin_fct::gpmc_ad4               = &pin_table::gpmc_ad4;
+pin_fct* const pin_fct::gpmc_ad5               = &pin_table::gpmc_ad5;
+pin_fct* const pin_fct::gpmc_ad6               = &pin_table::gpmc_ad6;
+pin_fct* const pin_fct::gpmc_ad7               = &pin_table::gpmc_ad7;
+pin_fct* const pin_fct::gpmc_ad8               = &pin_table::gpmc_ad8;
+pin_fct* const pin_fct::gpmc_ad9               = &pin_table::gpmc_ad9;
+pin_fct* const pin_fct::gpmc_advn_ale          = &pin_table::gpmc_advn_ale;
+pin_fct* const pin_fct::gpmc_be1n              = &pin_table::gpmc_be1n;
+pin_fct* const pin_fct::gpmc_ben0_cle          = &pin_table::gpmc_ben0_cle;
+pin_fct* const pin_fct::gpmc_ben1              = &pin_table::gpmc_ben1;
+pin_fct* const pin_fct::gpmc_clk               = &pin_table::gpmc_clk;
+pin_fct* const pin_fct::gpmc_csn0              = &pin_table::gpmc_csn0;
+pin_fct* const pin_fct::gpmc_csn1              = &pin_table::gpmc_csn1;
+pin_fct* const pin_fct::gpmc_csn2              = &pin_table::gpmc_csn2;
+pin_fct* const pin_fct::gpmc_oen_ren           = &pin_table::gpmc_oen_ren;
+pin_fct* const pin_fct::gpmc_wait0             = &pin_table::gpmc_wait0;
+pin_fct* const pin_fct::gpmc_wen               = &pin_table::gpmc_wen;
+pin_fct* const pin_fct::gpmc_wpn               = &pin_table::gpmc_wpn;
+pin_fct* const pin_fct::i2c1_scl               = &pin_table::i2c1_scl;
+pin_fct* const pin_fct::i2c1_sda               = &pin_table::i2c1_sda;
+pin_fct* const pin_fct::i2c2_scl               = &pin_table::i2c2_scl;
+pin_fct* const pin_fct::i2c2_sda               = &pin_table::i2c2_sda;
+pin_fct* const pin_fct::lcd_ac_bias_en         = &pin_table::lcd_ac_bias_en;
+pin_fct* const pin_fct::lcd_data0              = &pin_table::lcd_data0;
+pin_fct* const pin_fct::lcd_data1              = &pin_table::lcd_data1;
+pin_fct* const pin_fct::lcd_data10             = &pin_table::lcd_data10;
+pin_fct* const pin_fct::lcd_data11             = &pin_table::lcd_data11;
+pin_fct* const pin_fct::lcd_data12             = &pin_table::lcd_data12;
+pin_fct* const pin_fct::lcd_data13             = &pin_table::lcd_data13;
+pin_fct* const pin_fct::lcd_data14             = &pin_table::lcd_data14;
+pin_fct* const pin_fct::lcd_data15             = &pin_table::lcd_data15;
+pin_fct* const pin_fct::lcd_data16             = &pin_table::lcd_data16;
+pin_fct* const pin_fct::lcd_data17             = &pin_table::lcd_data17;
+pin_fct* const pin_fct::lcd_data18             = &pin_table::lcd_data18;
+pin_fct* const pin_fct::lcd_data19             = &pin_table::lcd_data19;
+pin_fct* const pin_fct::lcd_data2              = &pin_table::lcd_data2;
+pin_fct* const pin_fct::lcd_data20             = &pin_table::lcd_data20;
+pin_fct* const pin_fct::lcd_data21             = &pin_table::lcd_data21;
+pin_fct* const pin_fct::lcd_data22             = &pin_table::lcd_data22;
+pin_fct* const pin_fct::lcd_data23             = &pin_table::lcd_data23;
+pin_fct* const pin_fct::lcd_data3              = &pin_table::lcd_data3;
+pin_fct* const pin_fct::lcd_data4              = &pin_table::lcd_data4;
+pin_fct* const pin_fct::lcd_data5              = &pin_table::lcd_data5;
+pin_fct* const pin_fct::lcd_data6              = &pin_table::lcd_data6;
+pin_fct* const pin_fct::lcd_data7              = &pin_table::lcd_data7;
+pin_fct* const pin_fct::lcd_data8              = &pin_table::lcd_data8;
+pin_fct* const pin_fct::lcd_data9              = &pin_table::lcd_data9;
+pin_fct* const pin_fct::lcd_hsync              = &pin_table::lcd_hsync;
+pin_fct* const pin_fct::lcd_memory_clk_mux     = &pin_table::lcd_memory_clk_mux;
+pin_fct* const pin_fct::lcd_pclk               = &pin_table::lcd_pclk;
+pin_fct* const pin_fct::lcd_vsync              = &pin_table::lcd_vsync;
+pin_fct* const pin_fct::mcasp0_aclkr           = &pin_table::mcasp0_aclkr;
+pin_fct* const pin_fct::mcasp0_aclkx           = &pin_table::mcasp0_aclkx;
+pin_fct* const pin_fct::mcasp0_ahclkr          = &pin_table::mcasp0_ahclkr;
+pin_fct* const pin_fct::mcasp0_ahclkx          = &pin_table::mcasp0_ahclkx;
+pin_fct* const pin_fct::mcasp0_axr0            = &pin_table::mcasp0_axr0;
+pin_fct* const pin_fct::mcasp0_axr1            = &pin_table::mcasp0_axr1;
+pin_fct* const pin_fct::mcasp0_axr2            = &pin_table::mcasp0_axr2;
+pin_fct* const pin_fct::mcasp0_axr3            = &pin_table::mcasp0_axr3;
+pin_fct* const pin_fct::mcasp0_fsr             = &pin_table::mcasp0_fsr;
+pin_fct* const pin_fct::mcasp0_fsx             = &pin_table::mcasp0_fsx;
+pin_fct* const pin_fct::mcasp1_axr1            = &pin_table::mcasp1_axr1;
+pin_fct* const pin_fct::mcasp1_fsx             = &pin_table::mcasp1_fsx;
+pin_fct* const pin_fct::mii2_col               = &pin_table::mii2_col;
+pin_fct* const pin_fct::mii2_crs               = &pin_table::mii2_crs;
+pin_fct* const pin_fct::mii2_rxerr             = &pin_table::mii2_rxerr;
+pin_fct* const pin_fct::mmc0_sdcd              = &pin_table::mmc0_sdcd;
+pin_fct* const pin_fct::mmc0_sdwp              = &pin_table::mmc0_sdwp;
+pin_fct* const pin_fct::mmc1_clk               = &pin_table::mmc1_clk;
+pin_fct* const pin_fct::mmc1_cmd               = &pin_table::mmc1_cmd;
+pin_fct* const pin_fct::mmc1_dat0              = &pin_table::mmc1_dat0;
+pin_fct* const pin_fct::mmc1_dat1              = &pin_table::mmc1_dat1;
+pin_fct* const pin_fct::mmc1_dat2              = &pin_table::mmc1_dat2;
+pin_fct* const pin_fct::mmc1_dat3              = &pin_table::mmc1_dat3;
+pin_fct* const pin_fct::mmc1_dat4              = &pin_table::mmc1_dat4;
+pin_fct* const pin_fct::mmc1_dat5              = &pin_table::mmc1_dat5;
+pin_fct* const pin_fct::mmc1_dat6              = &pin_table::mmc1_dat6;
+pin_fct* const pin_fct::mmc1_dat7              = &pin_table::mmc1_dat7;
+pin_fct* const pin_fct::mmc1_sdcd              = &pin_table::mmc1_sdcd;
+pin_fct* const pin_fct::mmc1_sdwp              = &pin_table::mmc1_sdwp;
+pin_fct* const pin_fct::mmc2_clk               = &pin_table::mmc2_clk;
+pin_fct* const pin_fct::mmc2_dat0              = &pin_table::mmc2_dat0;
+pin_fct* const pin_fct::mmc2_dat1              = &pin_table::mmc2_dat1;
+pin_fct* const pin_fct::mmc2_dat2              = &pin_table::mmc2_dat2;
+pin_fct* const pin_fct::mmc2_dat3              = &pin_table::mmc2_dat3;
+pin_fct* const pin_fct::mmc2_dat4              = &pin_table::mmc2_dat4;
+pin_fct* const pin_fct::mmc2_dat5              = &pin_table::mmc2_dat5;
+pin_fct* const pin_fct::mmc2_dat6              = &pin_table::mmc2_dat6;
+pin_fct* const pin_fct::mmc2_dat7              = &pin_table::mmc2_dat7;
+pin_fct* const pin_fct::mmc2_sdcd              = &pin_table::mmc2_sdcd;
+pin_fct* const pin_fct::mmc2_sdwp              = &pin_table::mmc2_sdwp;
+pin_fct* const pin_fct::rgmii2_rctl            = &pin_table::rgmii2_rctl;
+pin_fct* const pin_fct::rgmii2_tctl            = &pin_table::rgmii2_tctl;
+pin_fct* const pin_fct::rgmii2_td2             = &pin_table::rgmii2_td2;
+pin_fct* const pin_fct::rgmii2_td3             = &pin_table::rgmii2_td3;
+pin_fct* const pin_fct::rmii2_crs_dv           = &pin_table::rmii2_crs_dv;
+pin_fct* const pin_fct::rmii2_rxerr            = &pin_table::rmii2_rxerr;
+pin_fct* const pin_fct::rmii2_txen             = &pin_table::rmii2_txen;
+pin_fct* const pin_fct::spi0_cs0               = &pin_table::spi0_cs0;
+pin_fct* const pin_fct::spi0_d0                = &pin_table::spi0_d0;
+pin_fct* const pin_fct::spi0_d1                = &pin_table::spi0_d1;
+pin_fct* const pin_fct::spi0_sclk              = &pin_table::spi0_sclk;
+pin_fct* const pin_fct::spi1_cs0               = &pin_table::spi1_cs0;
+pin_fct* const pin_fct::spi1_cs1               = &pin_table::spi1_cs1;
+pin_fct* const pin_fct::spi1_d0                = &pin_table::spi1_d0;
+pin_fct* const pin_fct::spi1_d1                = &pin_table::spi1_d1;
+pin_fct* const pin_fct::spi1_sclk              = &pin_table::spi1_sclk;
+pin_fct* const pin_fct::uart1_ctsn             = &pin_table::uart1_ctsn;
+pin_fct* const pin_fct::uart1_rtsn             = &pin_table::uart1_rtsn;
+pin_fct* const pin_fct::uart1_rxd              = &pin_table::uart1_rxd;
+pin_fct* const pin_fct::uart1_txd              = &pin_table::uart1_txd;
+pin_fct* const pin_fct::uart2_ctsn             = &pin_table::uart2_ctsn;
+pin_fct* const pin_fct::uart2_rtsn             = &pin_table::uart2_rtsn;
+pin_fct* const pin_fct::uart2_rxd              = &pin_table::uart2_rxd;
+pin_fct* const pin_fct::uart2_txd              = &pin_table::uart2_txd;
+pin_fct* const pin_fct::uart3_ctsn             = &pin_table::uart3_ctsn;
+pin_fct* const pin_fct::uart3_txd              = &pin_table::uart3_txd;
+pin_fct* const pin_fct::xdma_event_intr1       = &pin_table::xdma_event_intr1;
+pin_fct* const pin_fct::xdma_event_intr2       = &pin_table::xdma_event_intr2;
+
+
+unmuxed_pin pin_table::P8_1("P8_1", &GND, pin::OUT, pin::NONE);
+unmuxed_pin pin_table::P8_2("P8_2", &GND, pin::OUT, pin::NONE);
+gpio        pin_table::P8_3("P8_3", "gpmc_ad6"  ,  1, 6, &gpmc_ad6               , &mmc1_dat6              , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , &gpio1_6                ,7, pin::IN, pin::NONE);
+gpio        pin_table::P8_4("P8_4", "gpmc_ad7"  ,  1, 7, &gpmc_ad7               , &mmc1_dat7              , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , &gpio1_7                ,0, pin::IN, pin::NONE);
+gpio        pin_table::P8_5("P8_5", "gpmc_ad2"  ,  1, 2, &gpmc_ad2               , &mmc1_dat2              , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , &gpio1_2                ,0, pin::IN, pin::NONE);
+gpio        pin_table::P8_6("P8_6", "gpmc_ad3"  ,  1, 3, &gpmc_ad3               , &mmc1_dat3              , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , &gpio1_3                ,7, pin::IN, pin::NONE);
+/* ? */ pin         pin_table::P8_7("P8_7", "gpmc_advn_ale",  &gpmc_advn_ale          , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    ,0, pin::OUT, pin::NONE);
+gpio        pin_table::P8_8("P8_8", "gpmc_oen_ren",  2, 3, &gpmc_oen_ren           , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , &gpio2_3                ,0, pin::OUT, pin::NONE);
+gpio        pin_table::P8_9("P8_9", "gpmc_ben0_cle",  2, 5, &gpmc_ben0_cle          , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , &gpio2_5                ,0, pin::OUT, pin::NONE);
+gpio        pin_table::P8_10("P8_10", "gpmc_wen"  ,  2, 4, &gpmc_wen               , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , &gpio2_4                ,0, pin::OUT, pin::NONE);
+gpio        pin_table::P8_11("P8_11", "gpmc_ad13" ,  1, 13, &gpmc_ad13              , &lcd_data18             , &mmc1_dat5              , &mmc2_dat1              , &eqep2B_in              , NULL                    , NULL                    , &gpio1_13               ,7, pin::IN, pin::NONE);
+gpio        pin_table::P8_12("P8_12", "gpmc_ad12" ,  1, 12, &gpmc_ad12              , &lcd_data19             , &mmc1_dat4              , &mmc2_dat0              , &eqep2a_in              , NULL                    , NULL                    , &gpio1_12               ,7, pin::IN, pin::NONE);
+gpio        pin_table::P8_13("P8_13", "gpmc_ad9"  ,  0, 23, &gpmc_ad9               , &lcd_data22             , &mmc1_dat1              , &mmc2_dat5              , &ehrpwm2B               , NULL                    , NULL                    , &gpio0_23               ,7, pin::IN, pin::NONE);
+gpio        pin_table::P8_14("P8_14", "gpmc_ad10" ,  0, 26, &gpmc_ad10              , &lcd_data21             , &mmc1_dat2              , &mmc2_dat6              , &ehrpwm2_tripzone_input         , NULL                    , NULL                    , &gpio0_26               ,7, pin::IN, pin::NONE);
+gpio        pin_table::P8_15("P8_15", "gpmc_ad15" ,  1, 15, &gpmc_ad15              , &lcd_data16             , &mmc1_dat7              , &mmc2_dat3              , &eqep2_strobe           , NULL                    , NULL                    , &gpio1_15               ,7, pin::IN, pin::NONE);
+gpio        pin_table::P8_16("P8_16", "gpmc_ad14" ,  1, 14, &gpmc_ad14              , &lcd_data17             , &mmc1_dat6              , &mmc2_dat2              , &eqep2_index            , NULL                    , NULL                    , &gpio1_14               ,7, pin::IN, pin::NONE);
+gpio        pin_table::P8_17("P8_17", "gpmc_ad11" ,  0, 27, &gpmc_ad11              , &lcd_data20             , &mmc1_dat3              , &mmc2_dat7              , &ehrpwm0_synco          , NULL                    , NULL                    , &gpio0_27               ,7, pin::IN, pin::NONE);
+gpio        pin_table::P8_18("P8_18", "gpmc_clk"  ,  2, 1,  &gpmc_clk               , &lcd_memory_clk_mux         , NULL                    , &mmc2_clk               , NULL                    , NULL                    , &mcasp0_fsr             , &gpio2_1                ,7, pin::IN, pin::NONE);
+gpio        pin_table::P8_19("P8_19", "gpmc_ad8"  ,  0, 22, &gpmc_ad8               , &lcd_data23             , &mmc1_dat0              , &mmc2_dat4              , &ehrpwm2A               , NULL                    , NULL                    , &gpio0_22               ,7, pin::IN, pin::NONE);
+gpio        pin_table::P8_20("P8_20", "gpmc_csn2" ,  1, 31, &gpmc_csn2              , &gpmc_be1n              , &mmc1_cmd               , NULL                    , NULL                    , NULL                    , NULL                    , &gpio1_31               ,7, pin::IN, pin::NONE);
+gpio        pin_table::P8_21("P8_21", "gpmc_csn1" ,  1, 30, &gpmc_csn1              , &gpmc_clk               , &mmc1_clk               , NULL                    , NULL                    , NULL                    , NULL                    , &gpio1_30               ,7, pin::IN, pin::NONE);
+gpio        pin_table::P8_22("P8_22", "gpmc_ad5"  ,  1, 5 , &gpmc_ad5               , &mmc1_dat5              , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , &gpio1_5                ,0, pin::IN, pin::NONE);
+gpio        pin_table::P8_23("P8_23", "gpmc_ad4"  ,  1, 4 , &gpmc_ad4               , &mmc1_dat4              , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , &gpio1_4                ,0, pin::IN, pin::NONE);
+gpio        pin_table::P8_24("P8_24", "gpmc_ad1"  ,  1, 1 , &gpmc_ad1               , &mmc1_dat1              , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , &gpio1_1                ,0, pin::IN, pin::NONE);
+gpio        pin_table::P8_25("P8_25", "gpmc_ad0"  ,  1, 0 , &gpmc_ad0               , &mmc1_dat0              , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , &gpio1_0                ,0, pin::IN, pin::NONE);
+gpio        pin_table::P8_26("P8_26", "gpmc_csn0" ,  1, 29, &gpmc_csn0              , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , &gpio1_29               ,0, pin::OUT, pin::NONE);
+gpio        pin_table::P8_27("P8_27", "lcd_vsync" ,  2, 22, &lcd_vsync              , &gpmc_a8                , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , &gpio2_22               ,7, pin::IN, pin::NONE);
+gpio        pin_table::P8_28("P8_28", "lcd_pclk"  ,  2, 24, &lcd_pclk               , &gpmc_a10               , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , &gpio2_24               ,7, pin::IN, pin::NONE);
+gpio        pin_table::P8_29("P8_29", "lcd_hsync" ,  2, 23, &lcd_hsync              , &gpmc_a9                , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , &gpio2_23               ,7, pin::IN, pin::NONE);
+gpio        pin_table::P8_30("P8_30", "lcd_ac_bias_en",  2, 25, &lcd_ac_bias_en         , &gpmc_a11               , NULL                    , NULL                    , NULL                    , NULL                    , NULL                    , &gpio2_25               ,7, pin::IN, pin::NONE);
+gpio        pin_table::P8_31("P8_31", "lcd_data14",  0, 10, &lcd_data14             , &gpmc_a18               , NULL                    , &mcasp0_axr1            , NULL                    , NULL                    , NULL                    , &gpio0_10               ,0, pin::OUT, pin::NONE);
+gpio        pin_table::P8_32("P8_32", "lcd_data15",  0, 11, &lcd_data15             , &gpmc_a19               , NULL                    , &mcasp0_ahclkx          , &mcasp0_axr3            , NULL                    , NULL                    , &gpio0_11               ,0, pin::OUT, pin::NONE);
+gpio        pin_table::P8_33("P8_33", "lcd_data13",  0, 9 , &lcd_data13             , &gpmc_a17               , NULL                    , &mcasp0_fsr             , &mcasp0_axr3            , NULL                    , NULL                    , &gpio0_9                ,0, pin::OUT, pin::NONE);
+gpio        pin_table::P8_34("P8_34", "lcd_data11",  2, 17, &lcd_data11             , &gpmc_a15               , NULL                    , &mcasp0_ahclkr          , &mcasp0_axr2            , NULL                    , NULL                    , &gpio2_17               ,0, pin::OUT, pin::NONE);
+gpio        pin_table::P8_35("P8_35", "lcd_data12",  0, 8 , &lcd_data12             , &gpmc_a16               , NULL                    , &mcasp0_aclkr           , &mcasp0_axr2            , NULL                    , NULL                    , &gpio0_8                ,0, pin::OUT, pin::NONE);
+gpio        pin_table::P8_36("P8_36", "lcd_data10",  2, 16, &lcd_data10             , &gpmc_a14               , &ehrpwm1A               , &mcasp0_axr0            , &mcasp0_axr0            , NULL                    , &uart3_ctsn             , &gpio2_16               ,0, pin::OUT, pin::NONE);
+gpio        pin_table::P8_37("P8_37", "lcd_data8" ,  2, 14, &lcd_data8              , &gpmc_a12               , NULL                    , &mcasp0_aclkx           , NULL                    , NULL                    , &uart2_ctsn             , &gpio2_14               ,0, pin::OUT, pin::NONE);
+gpio        pin_table::P8_38("P8_38", "lcd_data9" ,  2, 15, &lcd_data9              , &gpmc_a13               , NULL                    , &mcasp0_fsx             , NULL                    , NULL                    , &uart2_rtsn             , &gpio2_15               ,0, pin::OUT, pin::NONE);
+gpio        pin_table::P8_39("P8_39", "lcd_data6" ,  2, 12, &lcd_data6              , &gpmc_a6                , NULL                    , &eqep2_index            , NULL                    , NULL                    , NULL                    , &gpio2_12               ,0, pin::OUT, pin::NONE);
+gpio        pin_table::P8_40("P8_40", "lcd_data7" ,  2, 13, &lcd_data7              , &gpmc_a7                , NULL                    , &eqep2_strobe           , NULL                    , NULL                    , NULL                    , &gpio2_13               ,0, pin::OUT, pin::NONE);
+gpio        pin_table::P8_41("P8_41", "lcd_data4" ,  2, 10, &lcd_data4              , &gpmc_a4                , NULL                    , &eQEP2A_in              , NULL                    , NULL                    , NULL                    , &gpio2_10               ,0, pin::OUT, pin::NONE);
+gpio        pin_table::P8_42("P8_42", "lcd_data5" ,  2, 11, &lcd_data5              , &gpmc_a5                , NULL                    , &eqep2b_in              , NULL                    , NULL                    , NULL                    , &gpio2_11               ,0, pin::OUT, pin::NONE);
+gpio        pin_table::P8_43("P8_43", "lcd_data2" ,  2, 8 , &lcd_data2              , &gpmc_a2                , NULL                    , &ehrpwm2_tripzone_input         , NULL                    , NULL                    , NULL                    , &gpio2_8                ,0, pin::OUT, pin::NONE);
+gpio        pin_table::P8_44("P8_44", "lcd_data3" ,  2, 9 , &lcd_data3              , &gpmc_a3                , NULL                    , &ehrpwm0_synco          , NULL                    , NULL                    , NULL                    , &gpio2_9                ,0, pin::OUT, pin::NONE);
+gpio        pin_table::P8_45("P8_45", "lcd_data0" ,  2, 6 , &lcd_data0              , &gpmc_a0                , NULL                    , &ehrpwm2A               , NULL                    , NULL                    , NULL                    , &gpio2_6                ,0, pin::OUT, pin::NONE);
+gpio        pin_table::P8_46("P8_46", "lcd_data1" ,  2, 7 , &lcd_data1              , &gpmc_a1                , NULL                    , &ehrpwm2B               , NULL                    , NULL                    , NULL                    , &gpio2_7                ,0, pin::OUT, pin::NONE);
+unmuxed_pin pin_table::P9_1("P9_1", &GND, pin::OUT, pin::NONE);
+unmuxed_pin pin_table::P9_2("P9_2", &GND, pin::OUT, pin::NONE);
+unmuxed_pin pin_table::P9_3("P9_3", &VDD_3V3EXP, pin::OUT, pin::NONE);
+unmuxed_pin pin_table::P9_4("P9_4", &VDD_3V3EXP, pin::OUT, pin::NONE);
+unmuxed_pin pin_table::P9_5("P9_5", &VDD_5V, pin::OUT, pin::NONE);
+unmuxed_pin pin_table::P9_6("P9_6", &VDD_5V, pin::OUT, pin::NONE);
+unmuxed_pin pin_table::P9_7("P9_7", &SYS_5V, pin::OUT, pin::NONE);
+unmuxed_pin pin_table::P9_8("P9_8", &SYS_5V, pin::OUT, pin::NONE);
+unmuxed_pin pin_table::P9_9("P9_9", &PWR_BUT, pin::OUT, pin::NONE);
+unmuxed_pin pin_table::P9_10("P9_10", &SYS_RESETn, pin::OUT, pin::NONE);
+gpio        pin_table::P9_11("P9_11", "gpmc_wait0",  0, 30, &gpmc_wait0             , &mii2_crs               , NULL                    , &rmii2_crs_dv           , &mmc1_sdcd              , NULL                    , NULL                    , &gpio0_30               ,0, pin::IN, pin::NONE);
+gpio        pin_table::P9_12("P9_12", "gpmc_ben1" ,  1, 28, &gpmc_ben1              , &mii2_col               , NULL                    , &mmc2_dat3              , NULL                    , NULL                    , &mcasp0_aclkr           , &gpio1_28               ,7, pin::IN, pin::NONE);
+gpio        pin_table::P9_13("P9_13", "gpmc_wpn"  ,  0, 31, &gpmc_wpn               , &mii2_rxerr             , NULL                    , &rmii2_rxerr            , &mmc2_sdcd              , NULL                    , NULL                    , &gpio0_31               ,7, pin::IN, pin::NONE);
+gpio        pin_table::P9_14("P9_14", "gpmc_a2"   ,  1, 18, &gpmc_a2                , &gmii2_txd3             , &rgmii2_td3             , &mmc2_dat1              , &gpmc_a18               , NULL                    , &ehrpwm1A               , &gpio1_18               ,7, pin::IN, pin::NONE);
+gpio        pin_table::P9_15("P9_15", "gpmc_a0"   ,  1, 16, &gpmc_a0                , &gmii2_txen             , &rgmii2_tctl            , &rmii2_txen             , &gpmc_a16               , NULL                    , &ehrpwm1_tripzone_input         , &gpio1_16               ,7, pin::IN, pin::NONE);
+gpio        pin_table::P9_16("P9_16", "gpmc_a3"   ,  1, 19, &gpmc_a3                , &gmii2_txd2             , &rgmii2_td2             , &mmc2_dat2              , &gpmc_a19               , NULL                    , &ehrpwm1B               , &gpio1_19               ,7, pin::IN, pin::NONE);
+/* ? */ gpio        pin_table::P9_17("P9_17", "spi0_cs0"  ,  0, 5 , &spi0_cs0               , &mmc2_sdwp              , &i2c1_scl               , NULL                    , NULL                    , NULL                    , NULL                    , &gpio0_5                ,2, pin::IN, pin::NONE);
+gpio        pin_table::P9_18("P9_18", "spi0_d1"   ,  0, 4 , &spi0_d1                , &mmc1_sdwp              , &i2c1_sda               , NULL                    , NULL                    , NULL                    , NULL                    , &gpio0_4                ,2, pin::IN, pin::NONE);
+gpio        pin_table::P9_19("P9_19", "uart1_rtsn",  0, 13, &uart1_rtsn             , NULL                    , &d_can0_rx              , &i2c2_scl               , &spi1_cs1               , NULL                    , NULL                    , &gpio0_13               ,3, pin::IN, pin::NONE);
+gpio        pin_table::P9_20("P9_20", "uart1_ctsn",  0, 12, &uart1_ctsn             , NULL                    , &d_can0_tx              , &i2c2_sda               , &spi1_cs0               , NULL                    , NULL                    , &gpio0_12               ,3, pin::IN, pin::NONE);
+gpio        pin_table::P9_21("P9_21", "spi0_d0"   ,  0, 3 , &spi0_d0                , &uart2_txd              , &i2c2_scl               , NULL                    , NULL                    , NULL                    , NULL                    , &gpio0_3                ,7, pin::IN, pin::NONE);
+gpio        pin_table::P9_22("P9_22", "spi0_sclk" ,  0, 2 , &spi0_sclk              , &uart2_rxd              , &i2c2_sda               , NULL                    , NULL                    , NULL                    , NULL                    , &gpio0_2                ,7, pin::IN, pin::NONE);
+gpio        pin_table::P9_23("P9_23", "gpmc_a1"   ,  1, 17, &gpmc_a1                , &gmii2_rxdv             , &rgmii2_rctl            , &mmc2_dat0              , &gpmc_a17               , NULL                    , &ehrpwm0_synco          , &gpio1_17               ,7, pin::IN, pin::NONE);
+gpio        pin_table::P9_24("P9_24", "uart1_txd" ,  0, 15, &uart1_txd              , &mmc2_sdwp              , &d_can1_rx              , &i2c1_scl               , NULL                    , NULL                    , NULL                    , &gpio0_15               ,7, pin::IN, pin::NONE);
+gpio        pin_table::P9_25("P9_25", "mcasp0_ahclkx",  3, 21, &mcasp0_ahclkx          , NULL                    , &mcasp0_axr3            , &mcasp1_axr1            , NULL                    , NULL                    , NULL                    , &gpio3_21               ,7, pin::IN, pin::NONE);
+gpio        pin_table::P9_26("P9_26", "uart1_rxd" ,  0, 14, &uart1_rxd              , &mmc1_sdwp              , &d_can1_tx              , &i2c1_sda               , NULL                    , NULL                    , NULL                    , &gpio0_14               ,7, pin::IN, pin::NONE);
+gpio        pin_table::P9_27("P9_27", "mcasp0_fsr",  3, 19, &mcasp0_fsr             , NULL                    , &mcasp0_axr3            , &mcasp1_fsx             , NULL                    , NULL                    , NULL                    , &gpio3_19               ,7, pin::IN, pin::NONE);
+gpio        pin_table::P9_28("P9_28", "mcasp0_ahclkr",  3, 17, &mcasp0_ahclkr          , NULL                    , &mcasp0_axr2            , &spi1_cs0               , &ecap2_in_pwm2_out         , NULL                    , NULL                    , &gpio3_17               ,3, pin::IN, pin::NONE);
+gpio        pin_table::P9_29("P9_29", "mcasp0_fsx",  3, 15, &mcasp0_fsx             , &ehrpwm0B               , NULL                    , &spi1_d0                , &mmc1_sdcd              , NULL                    , NULL                    , &gpio3_15               ,3, pin::IN, pin::NONE);
+gpio        pin_table::P9_30("P9_30", "mcasp0_axr0",  3, 16, &mcasp0_axr0            , NULL                    , NULL                    , &spi1_d1                , &mmc2_sdcd              , NULL                    , NULL                    , &gpio3_16               ,3, pin::IN, pin::NONE);
+gpio        pin_table::P9_31("P9_31", "mcasp0_aclkx",  3, 14, &mcasp0_aclkx           , &ehrpwm0A               , NULL                    , &spi1_sclk              , &mmc0_sdcd              , NULL                    , NULL                    , &gpio3_14               ,3, pin::IN, pin::NONE);
+unmuxed_pin pin_table::P9_32("P9_32", &VADC, pin::OUT, pin::NONE);
+unmuxed_pin pin_table::P9_33("P9_33", &AIN4, pin::OUT, pin::NONE);
+unmuxed_pin pin_table::P9_34("P9_34", &AGND, pin::OUT, pin::NONE);
+unmuxed_pin pin_table::P9_35("P9_35", &AIN6, pin::OUT, pin::NONE);
+unmuxed_pin pin_table::P9_36("P9_36", &AIN5, pin::OUT, pin::NONE);
+unmuxed_pin pin_table::P9_37("P9_37", &AIN2, pin::OUT, pin::NONE);
+unmuxed_pin pin_table::P9_38("P9_38", &AIN3, pin::OUT, pin::NONE);
+unmuxed_pin pin_table::P9_39("P9_39", &AIN0, pin::OUT, pin::NONE);
+unmuxed_pin pin_table::P9_40("P9_40", &AIN1, pin::OUT, pin::NONE);
+gpio        pin_table::P9_41("P9_41", "xdma_event_intr1",  0, 20, &xdma_event_intr1         , NULL                    , NULL                    , &clkout2                , NULL                    , NULL                    , NULL                    , &gpio0_20               ,3, pin::OUT, pin::NONE);
+gpio        pin_table::P9_42("P9_42", "ecap0_in_pwm0_out",  0, 7 , &ecap0_in_pwm0_out         , &uart3_txd              , &spi1_cs1               , NULL                    , &spi1_sclk              , &mmc0_sdwp              , &xdma_event_intr2         , &gpio0_7                ,7, pin::IN, pin::NONE);
+unmuxed_pin pin_table::P9_43("P9_43", &GND, pin::OUT, pin::NONE);
+unmuxed_pin pin_table::P9_44("P9_44", &GND, pin::OUT, pin::NONE);
+unmuxed_pin pin_table::P9_45("P9_45", &GND, pin::OUT, pin::NONE);
+unmuxed_pin pin_table::P9_46("P9_46", &GND, pin::OUT, pin::NONE);
+
+
+pin* pin::m_P8[46] = {&pin_table::P8_1, &pin_table::P8_2, &pin_table::P8_3, &pin_table::P8_4, &pin_table::P8_5, &pin_table::P8_6,
+		      &pin_table::P8_7, &pin_table::P8_8, &pin_table::P8_9, &pin_table::P8_10, &pin_table::P8_11, &pin_table::P8_12,
+		      &pin_table::P8_13, &pin_table::P8_14, &pin_table::P8_15, &pin_table::P8_16, &pin_table::P8_17, &pin_table::P8_18,
+		      &pin_table::P8_19, &pin_table::P8_20, &pin_table::P8_21, &pin_table::P8_22, &pin_table::P8_23, &pin_table::P8_24,
+		      &pin_table::P8_25, &pin_table::P8_26, &pin_table::P8_27, &pin_table::P8_28, &pin_table::P8_29, &pin_table::P8_30,
+		      &pin_table::P8_31, &pin_table::P8_32, &pin_table::P8_33, &pin_table::P8_34, &pin_table::P8_35, &pin_table::P8_36,
+		      &pin_table::P8_37, &pin_table::P8_38, &pin_table::P8_39, &pin_table::P8_40, &pin_table::P8_41, &pin_table::P8_42,
+		      &pin_table::P8_43, &pin_table::P8_44, &pin_table::P8_45, &pin_table::P8_46};
+
+pin* pin::m_P9[46] = {&pin_table::P9_1, &pin_table::P9_2, &pin_table::P9_3, &pin_table::P9_4, &pin_table::P9_5, &pin_table::P9_6,
+		      &pin_table::P9_7, &pin_table::P9_8, &pin_table::P9_9, &pin_table::P9_10, &pin_table::P9_11, &pin_table::P9_12,
+		      &pin_table::P9_13, &pin_table::P9_14, &pin_table::P9_15, &pin_table::P9_16, &pin_table::P9_17, &pin_table::P9_18,
+		      &pin_table::P9_19, &pin_table::P9_20, &pin_table::P9_21, &pin_table::P9_22, &pin_table::P9_23, &pin_table::P9_24,
+		      &pin_table::P9_25, &pin_table::P9_26, &pin_table::P9_27, &pin_table::P9_28, &pin_table::P9_29, &pin_table::P9_30,
+		      &pin_table::P9_31, &pin_table::P9_32, &pin_table::P9_33, &pin_table::P9_34, &pin_table::P9_35, &pin_table::P9_36,
+		      &pin_table::P9_37, &pin_table::P9_38, &pin_table::P9_39, &pin_table::P9_40, &pin_table::P9_41, &pin_table::P9_42,
+		      &pin_table::P9_43, &pin_table::P9_44, &pin_table::P9_45, &pin_table::P9_46};
 
 pin*
 pin::P8(unsigned char n)
@@ -549,7 +1091,7 @@ pin::get_fct()
 pin_fct*
 pin::get_gpio()
 {
-  return m_gpio;
+  return m_modes[7];
 }
 
 int
@@ -566,48 +1108,53 @@ pin::xport(pin_fct* fct, direction_t dir, pull_t pulls)
   }
 
   // Can we even export this function here?
-  int i = 0;
-  unsigned char mode;
-  pin** p = fct->m_pins;
-  while (*p) {
-    if (*p == this) break;
-    p++;
-    i++;
-  }
-  if (!*p) {
+  int mode = m_mode_of(fct);
+  if (mode < 0) {
     fprintf(stderr, "ERROR: Pin %s cannot export %s function.\n",
 	    get_name(), fct->get_name());
     return 0;
   }
-  mode = fct->m_mode[i];
 
   // Is it already exported somewhere else?
-  if (fct->m_pin != NULL && fct->m_pin != this) {
-    if (fct->m_pin->is_locked()) {
+  pin* other = fct->get_pin();
+  if (other != NULL && other != this) {
+    if (other->is_locked()) {
       fprintf(stderr, "ERROR: %s function is currently exported by locked pin %s.\n",
-	      fct->get_name(), fct->m_pin->get_name());
+	      fct->get_name(), other->get_name());
       return 0;
     }
 
     // ToDo: Automatically remux previous exporting pin
     fprintf(stderr, "ERROR: %s function is currently exported by pin %s.\n",
-	    fct->get_name(), fct->m_pin->get_name());
+	    fct->get_name(), other->get_name());
     return 0;
   }
 
   // Good to go!
-  m_fct->m_pin = NULL;
   m_fct = fct;
-  m_fct->m_pin = this;
 
   // Perform the muxing
-  FILE *fp = fopen(m_dev, "w");
+  char path[256];
+  m_path(path, sizeof(path));
+  FILE *fp = fopen(path, "w");
   if (fp == NULL) {
-    fprintf(stderr, "ERROR: Cannot open %s for writing: ", m_dev);
+    fprintf(stderr, "ERROR: Cannot open %s for writing: ", path);
     perror(0);
     return 0;
   }
 
+  int code = m_mux_code(mode, dir, pulls);
+  fprintf(fp, "%x\n", code);
+  fclose(fp);
+  m_code = code;
+
+  return 1;
+}
+
+
+int
+pin::m_mux_code(int mode, direction_t dir, pull_t pulls)
+{
   //
   // From: http://www.nathandumont.com/node/250
   //
@@ -619,16 +1166,44 @@ pin::xport(pin_fct* fct, direction_t dir, pull_t pulls)
   //
   int code = mode & 0x7;
   switch (pulls) {
-  case NONE: code |= 0x08;
-  case PU  : code |= 0x10;
-  case PD  : code |= 0x00;
+  case NONE: code |= 0x08; break;
+  case PU  : code |= 0x10; break;
+  case PD  : code |= 0x00; break;
   }
   if (dir == IN) code |= 0x20;
-  
-  fprintf(fp, "%x\n", code);
+
+  return code;
+}
+
+
+void
+pin::m_path(char* buf, size_t len)
+{
+  snprintf(buf, len, "%s%s/%s", SysfsAttr::root().c_str(), devdir, m_dev);
+}
+
+
+int
+pin::m_read_code()
+{
+  if (m_code >= 0) return m_code;
+
+  // The mux file reads "name: gpmc_ad12.gpio1_12 (0x44e10830/0x830 = 0x0027), ..."
+  char path[256];
+  m_path(path, sizeof(path));
+  FILE *fp = fopen(path, "r");
+  if (fp == NULL) return -1;
+
+  char line[128];
+  int code = -1;
+  if (fgets(line, sizeof(line), fp) != NULL) {
+    char* val = strstr(line, " = 0x");
+    if (val != NULL) code = strtol(val + 3, NULL, 16) & 0x3f;
+  }
   fclose(fp);
 
-  return 1;
+  m_code = code;
+  return code;
 }
 
 int
@@ -660,14 +1235,23 @@ pin::unlock(int key)
   m_key = 0;
 }
 
+int
+pin::m_mode_of(pin_fct* fct)
+{
+  for (int mode = 0; mode < 8; mode++) {
+    if (m_modes[mode] == fct) return mode;
+  }
+  return -1;
+}
 
-
-pin_fct::pin_fct(const char* name)
-  : m_name(name), m_pin(NULL)
+pin*
+pin::m_all(int i)
 {
-  for(int i = 0; i < 4; i++) m_pins[i] = NULL;
+  return (i < 46) ? m_P8[i] : m_P9[i-46];
 }
 
+
+
 const char*
 pin_fct::get_name()
 {
@@ -677,31 +1261,38 @@ pin_fct::get_name()
 pin*
 pin_fct::get_pin()
 {
-  return m_pin;
+  // The pins are the only record of which function they carry
+  for (int i = 0; i < 92; i++) {
+    if (pin::m_all(i)->m_fct == this) return pin::m_all(i);
+  }
+  return NULL;
 }
 
 pin*
 pin_fct::xport(pin::direction_t dir, pin::pull_t pulls)
 {
   // Already exported?
-  if (m_pin != NULL) return m_pin;
+  pin* p = get_pin();
+  if (p != NULL) return p;
 
   // Export it on the first unlocked pin that can
-  pin** p = m_pins;
-  while (*p) {
-    if (!(*p)->is_locked()) {
-      (*p)->xport(this, dir, pulls);
-      return *p;
+  for (int i = 0; i < 92; i++) {
+    p = pin::m_all(i);
+    if (p->m_mode_of(this) >= 0 && !p->is_locked()) {
+      // pin::xport() reports why it failed
+      if (!p->xport(this, dir, pulls)) return NULL;
+      return p;
     }
-    p++;
   }
 
   fprintf(stderr, "ERROR: Cannot export %s functionality: all possible pins (", get_name());
-  p = m_pins;
-  while (*p) {
-    if (p != m_pins) fprintf(stderr, ", ");
-    fprintf(stderr, "%s", (*p)->get_name());
-    p++;
+  const char* sep = "";
+  for (int i = 0; i < 92; i++) {
+    p = pin::m_all(i);
+    if (p->m_mode_of(this) >= 0) {
+      fprintf(stderr, "%s%s", sep, p->get_name());
+      sep = ", ";
+    }
   }
   fprintf(stderr, ") are locked.\n");
 
@@ -0,0 +1,153 @@
+#include "pwmchannel.h"
+#include <iostream>
+#include <limits.h>
+
+#include "mmappwm.h"
+#include "sysfspwm.h"
+
+// shadow value meaning "not known, always write"
+#define SHADOW_INVALID INT_MIN
+
+PwmChannel::PwmChannel()
+    : _backend(NULL), _backendType(SYSFS), _issued(0), _elided(0), _trace(0)
+{
+    invalidate();
+}
+
+PwmChannel::~PwmChannel()
+{
+    close();
+}
+
+bool PwmChannel::open(const std::string& device, backend_t backend)
+{
+    close();
+    invalidate();
+    resetWriteCounters();
+    resetLatencyStats();
+    _trace = TraceRing::channel(device.c_str());
+
+    if(backend == MMAP)
+    {
+        MmapPwm* regs = new MmapPwm();
+        if(regs->open(device))
+        {
+            _backend = regs;
+            _backendType = MMAP;
+            return true;
+        }
+        delete regs;
+        std::cerr << "Falling back to sysfs for PWM device " << device << std::endl;
+    }
+
+    SysfsPwm* sysfs = new SysfsPwm();
+    if(!sysfs->open(device))
+    {
+        delete sysfs;
+        return false;
+    }
+    _backend = sysfs;
+    _backendType = SYSFS;
+    return true;
+}
+
+void PwmChannel::close()
+{
+    delete _backend;
+    _backend = NULL;
+}
+
+bool PwmChannel::isOpen() const
+{
+    return _backend != NULL;
+}
+
+PwmChannel::backend_t PwmChannel::backend() const
+{
+    return _backendType;
+}
+
+std::string PwmChannel::requestStatus() const
+{
+    return _backend ? _backend->requestStatus() : std::string();
+}
+
+bool PwmChannel::set_request(int val)
+{
+    _issued.fetch_add(1, std::memory_order_relaxed);
+    const uint64_t start = LatencyHistogram::now();
+    const bool ok = _backend->set_request(val);
+    TraceRing::record(_trace, TraceRing::PWM_REQUEST, val, start, _latency.record(start), ok);
+    return ok;
+}
+
+bool PwmChannel::set_duty(int val)
+{
+    return write(&PwmBackend::set_duty, TraceRing::PWM_DUTY, _shadow_duty, val);
+}
+
+bool PwmChannel::set_period(int val)
+{
+    return write(&PwmBackend::set_period, TraceRing::PWM_PERIOD, _shadow_period, val);
+}
+
+bool PwmChannel::set_polarity(int val)
+{
+    return write(&PwmBackend::set_polarity, TraceRing::PWM_POLARITY, _shadow_polarity, val);
+}
+
+bool PwmChannel::set_run(int val)
+{
+    return write(&PwmBackend::set_run, TraceRing::PWM_RUN, _shadow_run, val);
+}
+
+void PwmChannel::invalidate()
+{
+    _shadow_duty = SHADOW_INVALID;
+    _shadow_period = SHADOW_INVALID;
+    _shadow_polarity = SHADOW_INVALID;
+    _shadow_run = SHADOW_INVALID;
+}
+
+unsigned long PwmChannel::writesIssued() const
+{
+    return _issued.load(std::memory_order_relaxed);
+}
+
+unsigned long PwmChannel::writesElided() const
+{
+    return _elided.load(std::memory_order_relaxed);
+}
+
+void PwmChannel::resetWriteCounters()
+{
+    _issued.store(0, std::memory_order_relaxed);
+    _elided.store(0, std::memory_order_relaxed);
+}
+
+LatencyHistogram::Stats PwmChannel::latencyStats() const
+{
+    return _latency.stats();
+}
+
+void PwmChannel::resetLatencyStats()
+{
+    _latency.reset();
+}
+
+bool PwmChannel::write(bool (PwmBackend::*set)(int), TraceRing::op_t op, int& shadow, int val)
+{
+    if(shadow == val)
+    {
+        _elided.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // on failure the device state is unknown, so retry on the next write
+    _issued.fetch_add(1, std::memory_order_relaxed);
+    const uint64_t start = LatencyHistogram::now();
+    const bool ok = (_backend->*set)(val);
+    TraceRing::record(_trace, op, val, start, _latency.record(start), ok);
+    shadow = ok ? val : SHADOW_INVALID;
+    return shadow == val;
+}
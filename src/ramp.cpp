@@ -0,0 +1,77 @@
+#include "ramp.h"
+
+Ramp::Ramp()
+    : _target(0), _current(0), _up(0), _down(0), _reversal(0), _output(NULL), _arg(NULL)
+{
+}
+
+void Ramp::setRates(double upPerSec, double downPerSec, double reversalPerSec)
+{
+    _up = upPerSec;
+    _down = downPerSec;
+    _reversal = reversalPerSec > 0 ? reversalPerSec : downPerSec;
+}
+
+bool Ramp::enabled() const
+{
+    return _up > 0 || _down > 0;
+}
+
+void Ramp::setOutput(output_t output, void* arg)
+{
+    _output = output;
+    _arg = arg;
+}
+
+void Ramp::setTarget(double target)
+{
+    _target = target;
+    if(target != _current)
+        MotionScheduler::instance().add(this);
+}
+
+void Ramp::reset(double value)
+{
+    MotionScheduler::instance().remove(this);
+    _target = value;
+    _current = value;
+}
+
+double Ramp::target() const
+{
+    return _target;
+}
+
+double Ramp::current() const
+{
+    return _current;
+}
+
+double Ramp::toward(double from, double to, double step)
+{
+    if(step <= 0)
+        return to;
+    if(from < to)
+        return from + step < to ? from + step : to;
+    return from - step > to ? from - step : to;
+}
+
+bool Ramp::tick()
+{
+    const double dt = MotionScheduler::instance().tickNs() * 1e-9;
+    const double target = _target;
+    const double current = _current;
+
+    double next;
+    if((current > 0 && target < 0) || (current < 0 && target > 0))
+        next = toward(current, 0, _reversal * dt);
+    else if(target > 0 ? target > current : target < current)
+        next = toward(current, target, _up * dt);
+    else
+        next = toward(current, target, _down * dt);
+
+    _current = next;
+    if(_output)
+        _output(next, _arg);
+    return next != target;
+}
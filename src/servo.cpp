@@ -3,66 +3,74 @@
 #include <fstream>
 #include <sstream>
 #include <exception>
+#include <stdlib.h> 
+#include <math.h>
+
+#include "sysfsattr.h"
 
 Servo::Servo() 
-    : _duty(0), _polarity(0), _run(0)
+    : _attached(false), _duty(0), _polarity(0), _run(0)
 {
 }
 
-void Servo::attach(const std::string& pin)
+void Servo::attach(const std::string& pin, PwmChannel::backend_t backend)
 {
-    std::string filename = pinToFile(pin); // should throw an exception when something's wrong with the pin name
+    const Pins::PwmPin* pwm = Pins::findPwm(pin);
+    if(pwm == NULL)
+    {
+        std::cerr << "Invalid pin name " << pin << std::endl;
+        _attached = false;
+        return;
+    }
+    attachDevice(pwm->name, pwm->device, backend);
+}
+
+void Servo::attachDevice(const char* pin, const char* device, PwmChannel::backend_t backend)
+{
+    // open the device once, it stays open until detach()
+    if(!_channel.open(device, backend))
+    {
+        _attached = false;
+        return;
+    }
 
     // check if the pwm device is not used by someone else
-    std::stringstream sysfsfile_request;
-    sysfsfile_request << SYSFS_EHRPWM_PREFIX << filename << "/" << SYSFS_EHRPWM_REQUEST;
-    std::ifstream req_file(sysfsfile_request.str().c_str());
-    std::string req_status;
-    std::getline(req_file, req_status);
-    std::cout << "req status: " << req_status << std::endl;
+    std::string req_status = _channel.requestStatus();
     if(req_status.find("free") == std::string::npos)
     {
         //throw std::exception();
-	std::cerr << "PWM device not available at this time." << std::endl;
+	std::cerr << "PWM device not available at this time." << std::endl << " Request status: " << req_status << std::endl;
         _attached = false;
     } 
     else 
     {
         _attached = true; 
     }
-    
-    // if everything is okay we can move forward with opening the other files 
-    std::stringstream sysfsfile_duty;
-    std::stringstream sysfsfile_period;
-    std::stringstream sysfsfile_polarity;
-    std::stringstream sysfsfile_run;
-
-    sysfsfile_duty << SYSFS_EHRPWM_PREFIX << filename << "/" << SYSFS_EHRPWM_DUTY;
-    sysfsfile_period << SYSFS_EHRPWM_PREFIX << filename << "/" << SYSFS_EHRPWM_PERIOD;
-    sysfsfile_run << SYSFS_EHRPWM_PREFIX << filename << "/" << SYSFS_EHRPWM_RUN;
-
-    _filename_request = sysfsfile_request.str();
-    _filename_duty = sysfsfile_duty.str();
-    _filename_period = sysfsfile_period.str();
-    _filename_run = sysfsfile_run.str();
 
+    _table.build(_calibration);
 
     set_request(1);    
     set_run(0);
     set_period(_PERIOD);
-    set_duty(MIN_DUTY_NS); // initialize to 0 degree
+    set_duty(dutyFor(0)); // initialize to 0 degree
     set_run(1);
 
     _pin = pin;
 }
 
 void Servo::write(int value)
+{
+    write((double)value);
+}
+
+void Servo::write(double angle)
 {
     if(_attached)
     {
-        _duty = MIN_DUTY_NS + value * DEGREE_TO_NS;
-        _lastValue = value;
-       set_duty(value);
+        cancelMotion();
+        _duty = dutyFor(angle);
+        _lastValue = angle;
+        set_duty(_duty);
     }
     else 
     {
@@ -74,7 +82,9 @@ void Servo::writeMicroseconds(int value)
 {
     if(_attached)
     {
-        set_duty(value*1000); // micro -> nano
+        cancelMotion();
+        _duty = value*1000; // micro -> nano
+        set_duty(_duty);
         _lastValue = value*1000;
     }
     else 
@@ -83,6 +93,52 @@ void Servo::writeMicroseconds(int value)
     }
 }
 
+void Servo::moveTo(double angle, double maxVel, double maxAccel, double maxJerk)
+{
+    if(!_attached)
+    {
+        std::cerr << "Servo object not attached to pin!" << std::endl;
+        return;
+    }
+
+    cancelMotion();
+
+    MotionProfile profile;
+    double start = _table.angleFor(_duty);
+    profile.plan(start, angle, maxVel, maxAccel, maxJerk);
+
+    // sample the whole move up front, the scheduler thread only writes duties
+    MotionScheduler& scheduler = MotionScheduler::instance();
+    const double tick = scheduler.tickNs() / 1e9;
+    const int n = (int)ceil(profile.duration() / tick);
+    std::vector<int>& samples = _trajectory.samples();
+    samples.resize(n);
+    for(int i = 0; i < n; ++i)
+        samples[i] = dutyFor(profile.position((i + 1) * tick));
+
+    _lastValue = angle;
+    if(n > 0)
+    {
+        _trajectory.start(&_channel, &_duty);
+        scheduler.add(&_trajectory);
+    }
+}
+
+bool Servo::isMoving()
+{
+    return MotionScheduler::instance().active(&_trajectory);
+}
+
+void Servo::wait()
+{
+    MotionScheduler::instance().wait(&_trajectory);
+}
+
+void Servo::cancelMotion()
+{
+    MotionScheduler::instance().remove(&_trajectory);
+}
+
 int Servo::read() const
 {
     if(_attached)
@@ -104,6 +160,7 @@ void Servo::stop()
 {
     if(_attached)
     {
+        cancelMotion();
         set_run(0);
         _run = 0;
     }
@@ -117,8 +174,10 @@ void Servo::detach()
 {
     if(_attached)
     {
+        cancelMotion();
         set_run(0);
         set_request(0);
+        _channel.close();
         _attached = false;
     }
     else 
@@ -139,24 +198,56 @@ std::string Servo::toString() const
     return ss.str();
 }
 
+unsigned long Servo::writesIssued() const
+{
+    return _channel.writesIssued();
+}
+
+unsigned long Servo::writesElided() const
+{
+    return _channel.writesElided();
+}
+
+LatencyHistogram::Stats Servo::latencyStats() const
+{
+    return _channel.latencyStats();
+}
+
+void Servo::resetLatencyStats()
+{
+    _channel.resetLatencyStats();
+}
 
-void Servo::set_request(const int val) 
+void Servo::calibrate(const ServoCalibration& calibration)
+{
+    _calibration = calibration;
+    if(_attached)
+        _table.build(_calibration);
+}
+
+const ServoCalibration& Servo::calibration() const
+{
+    return _calibration;
+}
+
+int Servo::dutyFor(double angle) const
+{
+    return _table.pulseNs(angle);
+}
+
+void Servo::set_request(const int val)
 {
     if(_attached)
     {
-        _sysfsfid_request.open(_filename_request.c_str());
-        _sysfsfid_request << val << std::endl;
-        _sysfsfid_request.close();
+        _channel.set_request(val);
     }
 }
 
-void Servo::set_duty(const int val) 
+void Servo::set_duty(const int val)
 {
     if(_attached)
     {
-        _sysfsfid_duty.open(_filename_duty.c_str());
-        _sysfsfid_duty << val << std::endl; 
-        _sysfsfid_duty.close();
+        _channel.set_duty(val);
     }
 }
 
@@ -164,9 +255,7 @@ void Servo::set_period(const int val)
 {
     if(_attached)
     {
-        _sysfsfid_period.open(_filename_period.c_str());
-        _sysfsfid_period << val << std::endl;
-        _sysfsfid_period.close();
+        _channel.set_period(val);
     }
 }
 
@@ -174,9 +263,7 @@ void Servo::set_run(const int val)
 {
     if(_attached)
     {
-        _sysfsfid_run.open(_filename_run.c_str());
-        _sysfsfid_run << val << std::endl;
-        _sysfsfid_run.close();
+        _channel.set_run(val);
     }
 }
 
@@ -189,26 +276,15 @@ Servo::~Servo()
     }
 }
 
-std::string Servo::pinToFile(const std::string& pin) 
-{
-    if(pin == "P8_13")
-        return "ehrpwm.2:1";
-    else if(pin == "P8_19")
-        return "ehrpwm.2:0";
-    else if(pin == "P9_14")
-        return "ehrpwm.1:0";
-    else if(pin == "P9_16")
-        return "ehrpwm.1:1";
-    else if(pin == "P9_31")
-        return "ehrpwm.0:0";
-    else if(pin == "P9_29")
-        return "ehrpwm.0:1";
-    else if(pin == "P9_42")
-        return "ecap.0";
-    else if(pin == "P9_28")
-        return "ecap.2";
-    else 
-//        throw std::exception();
-        std::cerr << "Invalid pin name" << std::endl;
-        ;
+void Servo::enablepwm()
+{
+    // the script muxes the real board, a fake sysfs tree needs nothing
+    if(!SysfsAttr::root().empty())
+        return;
+
+    std::stringstream ss ;
+    //TODO get current running directory
+    ss << "python /root/drivers/BeagleBone-Tools/servo/example9.py" << std::endl;
+    std::cout << ss.str().c_str();
+    system(ss.str().c_str());
 }
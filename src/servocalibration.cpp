@@ -0,0 +1,88 @@
+#include "servocalibration.h"
+#include <algorithm>
+
+#include "servo.h"
+
+static bool byAngle(const ServoCalibration::Point& a, const ServoCalibration::Point& b)
+{
+    return a.angle < b.angle;
+}
+
+ServoCalibration::ServoCalibration()
+    : minPulseNs(MIN_DUTY_NS), maxPulseNs(MAX_DUTY_NS), rangeDeg(180), centerTrimNs(0), reversed(false)
+{
+}
+
+void ServoCalibration::addPoint(double angle, int pulseNs)
+{
+    Point p;
+    p.angle = angle;
+    p.pulseNs = pulseNs;
+    points.insert(std::upper_bound(points.begin(), points.end(), p, byAngle), p);
+}
+
+PulseTable::PulseTable()
+{
+    build(ServoCalibration());
+}
+
+void PulseTable::build(const ServoCalibration& cal)
+{
+    // knots of the piecewise linear curve, endpoints included
+    std::vector<ServoCalibration::Point> knots;
+    ServoCalibration::Point p;
+    p.angle = 0;
+    p.pulseNs = cal.minPulseNs;
+    knots.push_back(p);
+    for(size_t k = 0; k < cal.points.size(); ++k)
+        if(cal.points[k].angle > 0 && cal.points[k].angle < cal.rangeDeg)
+            knots.push_back(cal.points[k]);
+    p.angle = cal.rangeDeg;
+    p.pulseNs = cal.maxPulseNs;
+    knots.push_back(p);
+
+    _rangeDeg = cal.rangeDeg;
+    _scale = SEGMENTS * 65536.0 / cal.rangeDeg;
+
+    for(int i = 0; i <= SEGMENTS; ++i)
+    {
+        double angle = cal.rangeDeg * i / SEGMENTS;
+        if(cal.reversed)
+            angle = cal.rangeDeg - angle;
+
+        size_t k = 0;
+        while(k + 2 < knots.size() && knots[k + 1].angle < angle)
+            ++k;
+        const ServoCalibration::Point& a = knots[k];
+        const ServoCalibration::Point& b = knots[k + 1];
+        const double t = b.angle > a.angle ? (angle - a.angle) / (b.angle - a.angle) : 0;
+        _base[i] = (int32_t)(a.pulseNs + t * (b.pulseNs - a.pulseNs) + 0.5) + cal.centerTrimNs;
+    }
+
+    for(int i = 0; i < SEGMENTS; ++i)
+        _step[i] = _base[i + 1] - _base[i];
+    _step[SEGMENTS] = 0;
+}
+
+double PulseTable::angleFor(int pulse) const
+{
+    // the table is monotonic, increasing or decreasing when reversed
+    const bool up = _base[SEGMENTS] >= _base[0];
+    int lo = 0, hi = SEGMENTS;
+    if(up ? pulse <= _base[0] : pulse >= _base[0])
+        return 0;
+    if(up ? pulse >= _base[SEGMENTS] : pulse <= _base[SEGMENTS])
+        return _rangeDeg;
+
+    while(hi - lo > 1)
+    {
+        const int mid = (lo + hi) / 2;
+        if(up ? _base[mid] <= pulse : _base[mid] >= pulse)
+            lo = mid;
+        else
+            hi = mid;
+    }
+
+    const double frac = _step[lo] ? (double)(pulse - _base[lo]) / _step[lo] : 0;
+    return (lo + frac) * _rangeDeg / SEGMENTS;
+}
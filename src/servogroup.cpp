@@ -0,0 +1,151 @@
+#include "servogroup.h"
+#include <iostream>
+#include <sstream>
+#include <time.h>
+
+ServoGroup::ServoGroup()
+    : _back(1), _lastCommitNs(0), _maxCommitNs(0)
+{
+}
+
+ServoGroup::~ServoGroup()
+{
+    for(size_t i = 0; i < _members.size(); ++i)
+    {
+        delete _members[i].servo;
+        delete _members[i].motor;
+    }
+}
+
+Servo& ServoGroup::addServo(const std::string& pin, PwmChannel::backend_t backend)
+{
+    Servo* servo = new Servo();
+    servo->attach(pin, backend);
+    add(servo, NULL, &servo->_channel);
+    return *servo;
+}
+
+MotorPwm& ServoGroup::addMotor(const std::string& pin, PwmChannel::backend_t backend)
+{
+    MotorPwm* motor = new MotorPwm();
+    motor->attach(pin, backend);
+    add(NULL, motor, &motor->_channel);
+    return *motor;
+}
+
+void ServoGroup::add(Servo* servo, MotorPwm* motor, PwmChannel* channel)
+{
+    Member m;
+    m.servo = servo;
+    m.motor = motor;
+    m.channel = channel;
+    _members.push_back(m);
+
+    // both buffers start out at the duty the channel was attached with
+    int duty = servo ? servo->dutyFor(0) : motor->dutyFor(0);
+    for(int b = 0; b < 2; ++b)
+    {
+        _duty[b].push_back(duty);
+        _value[b].push_back(0);
+    }
+}
+
+int ServoGroup::size() const
+{
+    return _members.size();
+}
+
+void ServoGroup::stage(int index, int value)
+{
+    if(index < 0 || index >= size())
+    {
+        std::cerr << "ServoGroup: no channel " << index << std::endl;
+        return;
+    }
+
+    const Member& m = _members[index];
+    if(m.servo)
+        m.servo->cancelMotion();
+    _duty[_back][index] = m.servo ? m.servo->dutyFor(value) : m.motor->dutyFor(value);
+    _value[_back][index] = value;
+}
+
+void ServoGroup::stageMicroseconds(int index, int value)
+{
+    if(index < 0 || index >= size() || !_members[index].servo)
+    {
+        std::cerr << "ServoGroup: no servo channel " << index << std::endl;
+        return;
+    }
+
+    _members[index].servo->cancelMotion();
+    _duty[_back][index] = value * 1000; // micro -> nano
+    _value[_back][index] = value * 1000;
+}
+
+void ServoGroup::commit()
+{
+    const std::vector<int>& duty = _duty[_back];
+    const int n = size();
+    struct timespec t0, t1;
+
+    // nothing but the duty writes between the two timestamps, ramped motors
+    // only get a new target and are written by their ramp
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for(int i = 0; i < n; ++i)
+    {
+        const Member& m = _members[i];
+        if(m.motor && m.motor->_ramp.enabled())
+            m.motor->setTarget(_value[_back][i]);
+        else if(m.servo ? m.servo->_attached : m.motor->_attached)
+            m.channel->set_duty(duty[i]);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+
+    _lastCommitNs = (t1.tv_sec - t0.tv_sec) * 1000000000L + (t1.tv_nsec - t0.tv_nsec);
+    if(_lastCommitNs > _maxCommitNs)
+        _maxCommitNs = _lastCommitNs;
+
+    // bookkeeping of the channel objects, outside of the timed window
+    for(int i = 0; i < n; ++i)
+    {
+        const Member& m = _members[i];
+        if(m.servo)
+        {
+            m.servo->_duty = duty[i];
+            m.servo->_lastValue = _value[_back][i];
+        }
+        else if(!m.motor->_ramp.enabled())
+        {
+            m.motor->_duty = duty[i];
+            m.motor->_lastValue = _value[_back][i];
+            m.motor->_output = _value[_back][i];
+        }
+    }
+
+    // the committed frame becomes the front, the next frame starts from it
+    int front = _back;
+    _back ^= 1;
+    _duty[_back] = _duty[front];
+    _value[_back] = _value[front];
+}
+
+long ServoGroup::lastCommitNs() const
+{
+    return _lastCommitNs;
+}
+
+long ServoGroup::maxCommitNs() const
+{
+    return _maxCommitNs;
+}
+
+std::string ServoGroup::toString() const
+{
+    std::stringstream ss;
+
+    ss << "Channels: " << _members.size() << ", last commit: " << _lastCommitNs
+       << " ns, max commit: " << _maxCommitNs << " ns";
+
+    return ss.str();
+}
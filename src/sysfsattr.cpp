@@ -0,0 +1,116 @@
+#include "sysfsattr.h"
+#include <fcntl.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+std::string SysfsAttr::_root;
+long SysfsAttr::_writeDelayNs = 0;
+
+SysfsAttr::SysfsAttr()
+    : _fd(-1)
+{
+}
+
+SysfsAttr::~SysfsAttr()
+{
+    close();
+}
+
+bool SysfsAttr::open(const std::string& path)
+{
+    close();
+    _path = path;
+    _fd = ::open(path.c_str(), O_RDWR | O_CLOEXEC);
+    if(_fd < 0)
+        _fd = ::open(path.c_str(), O_WRONLY | O_CLOEXEC);
+    return _fd >= 0;
+}
+
+void SysfsAttr::close()
+{
+    if(_fd >= 0)
+    {
+        ::close(_fd);
+        _fd = -1;
+    }
+}
+
+bool SysfsAttr::isOpen() const
+{
+    return _fd >= 0;
+}
+
+const std::string& SysfsAttr::path() const
+{
+    return _path;
+}
+
+bool SysfsAttr::write(int value)
+{
+    // format right to left into the end of the buffer, no locale, no stdio
+    char buf[16];
+    char* p = buf + sizeof(buf);
+    unsigned int u = value < 0 ? 0u - (unsigned int)value : (unsigned int)value;
+    *--p = '\n';
+    do
+    {
+        *--p = (char)('0' + u % 10);
+        u /= 10;
+    } while(u);
+    if(value < 0)
+        *--p = '-';
+
+    ssize_t len = buf + sizeof(buf) - p;
+    if(_writeDelayNs)
+        delay();
+    return pwrite(_fd, p, len, 0) == len;
+}
+
+bool SysfsAttr::write(const char* value)
+{
+    ssize_t len = strlen(value);
+    if(_writeDelayNs)
+        delay();
+    return pwrite(_fd, value, len, 0) == len;
+}
+
+bool SysfsAttr::read(std::string& value) const
+{
+    char buf[128];
+    ssize_t len = pread(_fd, buf, sizeof(buf) - 1, 0);
+    if(len < 0)
+        return false;
+    buf[len] = '\0';
+    char* nl = strchr(buf, '\n');
+    if(nl)
+        *nl = '\0';
+    value = buf;
+    return true;
+}
+
+void SysfsAttr::setRoot(const std::string& root)
+{
+    _root = root;
+}
+
+const std::string& SysfsAttr::root()
+{
+    return _root;
+}
+
+void SysfsAttr::setWriteDelayNs(long ns)
+{
+    _writeDelayNs = ns;
+}
+
+void SysfsAttr::delay()
+{
+    // spin, sleeping would round microsecond delays up to the timer slack
+    struct timespec start, now;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    do
+    {
+        clock_gettime(CLOCK_MONOTONIC, &now);
+    } while((now.tv_sec - start.tv_sec) * 1000000000L + (now.tv_nsec - start.tv_nsec) < _writeDelayNs);
+}
@@ -0,0 +1,280 @@
+#include "sysfspwm.h"
+#include <iostream>
+#include <map>
+#include <dirent.h>
+#include <errno.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include "pins.h"
+
+#define SYSFS_PWM_PREFIX "/sys/class/pwm/"
+
+// legacy ehrpwm.X:Y layout (3.2 kernels)
+#define SYSFS_PWM_REQUEST "request"
+#define SYSFS_PWM_DUTY "duty_ns"
+#define SYSFS_PWM_PERIOD "period_ns"
+#define SYSFS_PWM_POLARITY "polarity"
+#define SYSFS_PWM_RUN "run"
+
+// pwmchipN/pwmM layout (3.8 and later kernels)
+#define SYSFS_PWMCHIP_EXPORT "export"
+#define SYSFS_PWMCHIP_UNEXPORT "unexport"
+#define SYSFS_PWMCHIP_DUTY "duty_cycle"
+#define SYSFS_PWMCHIP_PERIOD "period"
+#define SYSFS_PWMCHIP_POLARITY "polarity"
+#define SYSFS_PWMCHIP_ENABLE "enable"
+
+
+static bool exists(const std::string& path)
+{
+    struct stat st;
+    return stat(path.c_str(), &st) == 0;
+}
+
+SysfsPwm::SysfsPwm()
+    : _layout(LEGACY), _index(0), _exported(false), _adopted(false)
+{
+}
+
+SysfsPwm::~SysfsPwm()
+{
+    close();
+}
+
+bool SysfsPwm::open(const std::string& device)
+{
+    _device = device;
+    std::string dir = SysfsAttr::root() + SYSFS_PWM_PREFIX + device;
+    if(exists(dir))
+        return openLegacy(dir + "/");
+
+    if(!resolveChip(device))
+    {
+        std::cerr << "Cannot find PWM device " << device << " in " << SysfsAttr::root() << SYSFS_PWM_PREFIX << std::endl;
+        return false;
+    }
+    return openChip();
+}
+
+bool SysfsPwm::openLegacy(const std::string& dir)
+{
+    _layout = LEGACY;
+
+    bool ok = _request.open(dir + SYSFS_PWM_REQUEST);
+    ok = _duty.open(dir + SYSFS_PWM_DUTY) && ok;
+    ok = _period.open(dir + SYSFS_PWM_PERIOD) && ok;
+    ok = _run.open(dir + SYSFS_PWM_RUN) && ok;
+    // polarity is optional, ecap devices do not have it
+    _polarity.open(dir + SYSFS_PWM_POLARITY);
+
+    if(!ok)
+    {
+        std::cerr << "Cannot open PWM device " << dir << ": " << strerror(errno) << std::endl;
+        close();
+    }
+    return ok;
+}
+
+bool SysfsPwm::resolveChip(const std::string& device)
+{
+    // chip directories do not change while running, resolve each device once
+    // per sysfs root; channels may be opened from several threads
+    static std::map<std::string, std::pair<std::string, int> > chips;
+    static pthread_mutex_t chipsMutex = PTHREAD_MUTEX_INITIALIZER;
+    const std::string key = SysfsAttr::root() + ":" + device;
+
+    pthread_mutex_lock(&chipsMutex);
+    std::map<std::string, std::pair<std::string, int> >::const_iterator it = chips.find(key);
+    const bool cached = it != chips.end();
+    if(cached)
+    {
+        _chip = it->second.first;
+        _index = it->second.second;
+    }
+    pthread_mutex_unlock(&chipsMutex);
+    if(cached)
+        return true;
+
+    int module, output = 0;
+    unsigned long addr;
+    if(sscanf(device.c_str(), "ehrpwm.%d:%d", &module, &output) == 2 && module >= 0 && module <= 2)
+        addr = Pins::PWMSS_BASE[module] + Pins::EHRPWM_OFFSET;
+    else if(sscanf(device.c_str(), "ecap.%d", &module) == 1 && module >= 0 && module <= 2)
+        addr = Pins::PWMSS_BASE[module] + Pins::ECAP_OFFSET;
+    else
+        return false;
+
+    // pwmchipN links to .../<address>.pwm/pwm/pwmchipN (or <address>.ehrpwm, .ecap)
+    char name[16];
+    snprintf(name, sizeof(name), "/%08lx.", addr);
+
+    const std::string prefix = SysfsAttr::root() + SYSFS_PWM_PREFIX;
+    DIR* dirp = opendir(prefix.c_str());
+    if(dirp == NULL)
+        return false;
+
+    struct dirent* ent;
+    while((ent = readdir(dirp)) != NULL)
+    {
+        if(strncmp(ent->d_name, "pwmchip", 7) != 0)
+            continue;
+
+        std::string chip = prefix + ent->d_name;
+        char target[PATH_MAX];
+        if(realpath(chip.c_str(), target) && strstr(target, name))
+        {
+            _chip = chip + "/";
+            _index = output;
+            pthread_mutex_lock(&chipsMutex);
+            chips[key] = std::make_pair(_chip, _index);
+            pthread_mutex_unlock(&chipsMutex);
+            break;
+        }
+    }
+    closedir(dirp);
+    return !_chip.empty();
+}
+
+bool SysfsPwm::openChip()
+{
+    _layout = PWMCHIP;
+
+    // the export file creates pwmM, or pwm-N:M on some vendor kernels
+    std::string dir = channelDir();
+    _exported = false;
+    _adopted = false;
+    if(dir.empty())
+    {
+        SysfsAttr exp;
+        if(!exp.open(_chip + SYSFS_PWMCHIP_EXPORT) || !exp.write(_index))
+        {
+            std::cerr << "Cannot export PWM " << _index << " of " << _chip << ": " << strerror(errno) << std::endl;
+            return false;
+        }
+        _exported = true;
+        dir = channelDir();
+    }
+
+    bool ok = !dir.empty();
+    ok = ok && _duty.open(dir + SYSFS_PWMCHIP_DUTY);
+    ok = ok && _period.open(dir + SYSFS_PWMCHIP_PERIOD);
+    ok = ok && _run.open(dir + SYSFS_PWMCHIP_ENABLE);
+    if(ok)
+        _polarity.open(dir + SYSFS_PWMCHIP_POLARITY);
+
+    // exported but disabled: left behind by a dead process, take it over
+    std::string enable;
+    if(ok && !_exported && _run.read(enable) && enable.compare(0, 1, "0") == 0)
+    {
+        _exported = true;
+        _adopted = true;
+    }
+
+    if(!ok)
+    {
+        std::cerr << "Cannot open PWM device " << _chip << " channel " << _index << ": " << strerror(errno) << std::endl;
+        set_request(0);
+        close();
+    }
+    return ok;
+}
+
+std::string SysfsPwm::channelDir() const
+{
+    char name[32];
+    snprintf(name, sizeof(name), "pwm%d", _index);
+    if(exists(_chip + name))
+        return _chip + name + "/";
+
+    int chip = atoi(_chip.c_str() + _chip.rfind("pwmchip") + 7);
+    snprintf(name, sizeof(name), "pwm-%d:%d", chip, _index);
+    if(exists(_chip + name))
+        return _chip + name + "/";
+
+    return std::string();
+}
+
+void SysfsPwm::close()
+{
+    _request.close();
+    _duty.close();
+    _period.close();
+    _polarity.close();
+    _run.close();
+}
+
+std::string SysfsPwm::requestStatus() const
+{
+    std::string status;
+    if(_layout == LEGACY)
+        _request.read(status);
+    else if(_adopted)
+        status = _device + " is free (adopted a disabled export)";
+    else if(_exported)
+        status = _device + " is free";
+    else
+        status = _device + " already exported by another user";
+    return status;
+}
+
+bool SysfsPwm::set_request(int val)
+{
+    if(_layout == LEGACY)
+        return write(_request, val);
+
+    // the channel was exported when it was opened, releasing unexports it
+    if(val || !_exported)
+        return true;
+
+    close();
+    SysfsAttr unexp;
+    if(!unexp.open(_chip + SYSFS_PWMCHIP_UNEXPORT) || !unexp.write(_index))
+    {
+        std::cerr << "Cannot unexport PWM " << _index << " of " << _chip << ": " << strerror(errno) << std::endl;
+        return false;
+    }
+    _exported = false;
+    _adopted = false;
+    return true;
+}
+
+bool SysfsPwm::set_duty(int val)
+{
+    return write(_duty, val);
+}
+
+bool SysfsPwm::set_period(int val)
+{
+    return write(_period, val);
+}
+
+bool SysfsPwm::set_polarity(int val)
+{
+    if(_layout == LEGACY)
+        return write(_polarity, val);
+
+    if(_polarity.write(val ? "inversed" : "normal"))
+        return true;
+
+    std::cerr << "Cannot write polarity to " << _polarity.path() << ": " << strerror(errno) << std::endl;
+    return false;
+}
+
+bool SysfsPwm::set_run(int val)
+{
+    return write(_run, val);
+}
+
+bool SysfsPwm::write(SysfsAttr& attr, int val)
+{
+    if(attr.write(val))
+        return true;
+
+    std::cerr << "Cannot write " << val << " to " << attr.path() << ": " << strerror(errno) << std::endl;
+    return false;
+}
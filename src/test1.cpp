@@ -30,20 +30,14 @@ int main(int argc, char** argv)
 
 
 
-//Angle from 0 to 180 degrees
-    for(int i=0; i<180; ++i)
-    {   
-        std::cout << i << std::endl; 
-        servo.write(i);
-        usleep(200000);
-    }
-    
-    for(int i=180; i>0; --i)
-    {    
-        std::cout << i << std::endl; 
-        servo.write(i);
-        usleep(200000);
-    }
+//Angle from 0 to 180 degrees, 5 degrees per second
+    std::cout << "Sweep to 180" << std::endl;
+    servo.moveTo(180, 5, 10);
+    servo.wait();
+
+    std::cout << "Sweep to 0" << std::endl;
+    servo.moveTo(0, 5, 10);
+    servo.wait();
 
     servo.detach();
 
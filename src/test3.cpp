@@ -14,10 +14,13 @@ int main(int argc, char** argv)
         sleep(1);
     }
 	md.init();
-	md.forward(2,10);
-	md.backward(2,10);
-	md.turnleft(2,10);
-	md.turnright(2,10);
+	// maneuvers return at once and run one after the other
+	md.forward(2000,10);
+	md.enqueue(MotorDriver::BACKWARD,2000,10);
+	md.enqueue(MotorDriver::TURNLEFT,2000,10);
+	md.enqueue(MotorDriver::TURNRIGHT,2000,10);
+	while(md.busy())
+		usleep(10000);
     md.stop();
 	md.detach();
 
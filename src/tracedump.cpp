@@ -0,0 +1,105 @@
+#include "tracering.h"
+#include <vector>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/*
+ * Prints a trace ring file written by TraceRing::open() or TraceRing::save(),
+ * oldest event first.
+ *
+ * usage: tracedump [-c] file
+ *
+ * -c exports comma separated values instead, with absolute timestamps.
+ */
+
+static const char* opName(uint8_t op)
+{
+    static const char* const names[] = {"?", "pwm request", "pwm duty", "pwm period", "pwm polarity",
+                                        "pwm run", "gpio set", "gpio get", "port set", "port clear"};
+    return op < sizeof(names) / sizeof(names[0]) ? names[op] : names[0];
+}
+
+int main(int argc, char** argv)
+{
+    bool csv = false;
+    int opt;
+    while((opt = getopt(argc, argv, "c")) != -1)
+    {
+        if(opt != 'c')
+            break;
+        csv = true;
+    }
+    if(optind != argc - 1)
+    {
+        fprintf(stderr, "usage: %s [-c] file\n", argv[0]);
+        return 2;
+    }
+
+    FILE* fp = fopen(argv[optind], "rb");
+    if(fp == NULL)
+    {
+        perror(argv[optind]);
+        return 1;
+    }
+    std::vector<uint64_t> buf;
+    uint64_t chunk[512];
+    size_t n;
+    while((n = fread(chunk, 1, sizeof(chunk), fp)) > 0)
+        buf.insert(buf.end(), chunk, chunk + (n + 7) / 8);
+    fclose(fp);
+
+    const TraceRing::Header* h = (const TraceRing::Header*)buf.data();
+    if(buf.size() * 8 < sizeof(TraceRing::Header) || memcmp(h->magic, "BBTRACE", 8) != 0
+       || h->version != TraceRing::VERSION || h->capacity == 0 || (h->capacity & (h->capacity - 1))
+       || buf.size() * 8 < TraceRing::size(h))
+    {
+        fprintf(stderr, "%s is not a trace ring file\n", argv[optind]);
+        return 1;
+    }
+
+    const uint32_t head = h->head.load(std::memory_order_relaxed);
+    uint32_t channels = h->channels.load(std::memory_order_relaxed);
+    if(channels > TraceRing::MAX_CHANNELS)
+        channels = TraceRing::MAX_CHANNELS;
+    const uint32_t count = head < h->capacity ? head : h->capacity;
+    const TraceRing::Event* events = TraceRing::events(h);
+
+    if(csv)
+        printf("seq,timestamp_ns,channel,op,value,latency_ns,ok\n");
+    else
+        printf("%u events recorded, the last %u kept\n\n%12s %-12s %-12s %10s %10s\n", head, count,
+               "time us", "channel", "operation", "value", "latency ns");
+
+    uint64_t first = 0;
+    unsigned torn = 0;
+    for(uint32_t i = head - count; i != head; ++i)
+    {
+        const TraceRing::Event& e = events[i & (h->capacity - 1)];
+        if(e.seq.load(std::memory_order_relaxed) != i + 1)
+        {
+            // overwritten or interrupted while being written
+            ++torn;
+            continue;
+        }
+        const char* channel = e.channel > 0 && e.channel < channels ? h->names[e.channel] : "?";
+        const bool mask = e.op == TraceRing::GPIO_PORT_SET || e.op == TraceRing::GPIO_PORT_CLEAR;
+        const bool ok = !(e.flags & TraceRing::FAILED);
+        if(csv)
+        {
+            printf("%u,%llu,%s,%s,", i + 1, (unsigned long long)e.timestampNs, channel, opName(e.op));
+            printf(mask ? "0x%08x" : "%d", e.value);
+            printf(",%u,%d\n", e.latencyNs, ok);
+            continue;
+        }
+        if(first == 0)
+            first = e.timestampNs;
+        printf("%12.1f %-12s %-12s ", (e.timestampNs - first) / 1e3, channel, opName(e.op));
+        printf(mask ? "0x%08x" : "%10d", e.value);
+        printf(" %10u%s\n", e.latencyNs, ok ? "" : " FAILED");
+    }
+    if(torn)
+        fprintf(stderr, "%u events skipped, incomplete\n", torn);
+    return 0;
+}
@@ -0,0 +1,121 @@
+#include "tracering.h"
+#include <iostream>
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+static_assert(sizeof(TraceRing::Event) == 24, "trace event layout");
+static_assert(sizeof(TraceRing::Header) % 8 == 0, "trace header layout");
+
+namespace
+{
+struct MemoryRing
+{
+    TraceRing::Header header;
+    TraceRing::Event events[TraceRing::DEFAULT_CAPACITY];
+};
+
+// constant initialized, so it records even from static constructors
+MemoryRing memoryRing = {{"BBTRACE", TraceRing::VERSION, TraceRing::DEFAULT_CAPACITY, {0}, {1}, {{0}}}, {}};
+
+pthread_mutex_t namesMutex = PTHREAD_MUTEX_INITIALIZER;
+size_t mappedSize = 0;
+}
+
+std::atomic<TraceRing::Header*> TraceRing::_ring(&memoryRing.header);
+
+uint16_t TraceRing::channel(const char* name)
+{
+    pthread_mutex_lock(&namesMutex);
+    Header* h = _ring.load(std::memory_order_acquire);
+    const uint32_t n = h->channels.load(std::memory_order_relaxed);
+    uint16_t id = 0;
+    for(uint32_t c = 1; c < n && id == 0; ++c)
+        if(strncmp(h->names[c], name, NAME_LEN - 1) == 0)
+            id = c;
+    if(id == 0 && n < MAX_CHANNELS)
+    {
+        strncpy(h->names[n], name, NAME_LEN - 1);
+        h->channels.store(n + 1, std::memory_order_release);
+        id = n;
+    }
+    pthread_mutex_unlock(&namesMutex);
+    return id;
+}
+
+bool TraceRing::open(const char* path, uint32_t capacity)
+{
+    uint32_t events = 1;
+    while(events < capacity)
+        events <<= 1;
+    const size_t bytes = sizeof(Header) + events * sizeof(Event);
+
+    int fd = ::open(path, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if(fd < 0 || ftruncate(fd, bytes) != 0)
+    {
+        std::cerr << "Cannot create trace file " << path << ": " << strerror(errno) << std::endl;
+        if(fd >= 0)
+            ::close(fd);
+        return false;
+    }
+    void* p = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if(p == MAP_FAILED)
+    {
+        std::cerr << "Cannot map trace file " << path << ": " << strerror(errno) << std::endl;
+        return false;
+    }
+
+    // the file is zero filled, so every slot reads as not written
+    Header* h = (Header*)p;
+    pthread_mutex_lock(&namesMutex);
+    Header* old = _ring.load(std::memory_order_relaxed);
+    memcpy(h->magic, old->magic, sizeof(h->magic));
+    h->version = VERSION;
+    h->capacity = events;
+    memcpy(h->names, old->names, sizeof(h->names));
+    h->channels.store(old->channels.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    _ring.store(h, std::memory_order_release);
+    pthread_mutex_unlock(&namesMutex);
+
+    if(old != &memoryRing.header)
+        munmap(old, mappedSize);
+    mappedSize = bytes;
+    return true;
+}
+
+void TraceRing::close()
+{
+    pthread_mutex_lock(&namesMutex);
+    Header* old = _ring.load(std::memory_order_relaxed);
+    if(old != &memoryRing.header)
+    {
+        memcpy(memoryRing.header.names, old->names, sizeof(old->names));
+        memoryRing.header.channels.store(old->channels.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        _ring.store(&memoryRing.header, std::memory_order_release);
+        munmap(old, mappedSize);
+        mappedSize = 0;
+    }
+    pthread_mutex_unlock(&namesMutex);
+}
+
+bool TraceRing::save(const char* path)
+{
+    const Header* h = _ring.load(std::memory_order_acquire);
+    int fd = ::open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if(fd < 0)
+    {
+        std::cerr << "Cannot create trace file " << path << ": " << strerror(errno) << std::endl;
+        return false;
+    }
+    // events still being written are told apart by their seq
+    const ssize_t bytes = size(h);
+    const bool ok = write(fd, h, bytes) == bytes;
+    if(!ok)
+        std::cerr << "Cannot write trace file " << path << ": " << strerror(errno) << std::endl;
+    ::close(fd);
+    return ok;
+}